@@ -0,0 +1,403 @@
+/*
+   Code by: Or Yamin
+   Project: Deque (growable ring buffer) data structure
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdlib.h> /* malloc free size_t */
+#include <string.h> /* memcpy */
+#include <assert.h> /* assert */
+
+#include "deque.h"
+
+#define GROWTH_FACTOR 2
+#define MIN_CAPACITY 8
+#define MAX_SIZE ((size_t)-1)
+
+/* capacity is always a power of two so wrapping an index is a single mask */
+struct deque
+{
+	size_t head;
+	size_t size;
+	size_t capacity;
+	size_t element_size;
+	char *buffer;
+};
+
+static size_t RoundUpCapacity(size_t capacity);
+static int EnsureRoom(deque_t *deque, size_t count, char **old_buffer);
+static int Grow(deque_t *deque, size_t new_capacity, char **old_buffer);
+static char *SlotAddress(const deque_t *deque, size_t index);
+static void CopyIn(deque_t *deque, size_t index, const char *src, size_t count);
+static void CopyOut(const deque_t *deque, size_t index, char *dest, size_t count);
+
+
+deque_t *DequeCreate(size_t capacity, size_t element_size)
+{
+	deque_t *deque = NULL;
+
+	assert(0 < element_size);
+
+	deque = (deque_t *)malloc(sizeof(deque_t));
+	if (NULL == deque)
+	{
+		return NULL;
+	}
+
+	deque->head = 0;
+	deque->size = 0;
+	deque->capacity = RoundUpCapacity(capacity);
+	deque->element_size = element_size;
+	deque->buffer = NULL;
+	if (0 != deque->capacity && deque->capacity <= MAX_SIZE / element_size)
+	{
+		deque->buffer = (char *)malloc(deque->capacity * element_size);
+	}
+	if (NULL == deque->buffer)
+	{
+		free(deque);
+		return NULL;
+	}
+
+	return deque;
+}
+
+
+
+void DequeDestroy(deque_t *deque)
+{
+	assert(NULL != deque);
+
+	free(deque->buffer);
+	free(deque);
+}
+
+
+
+int DequePushBack(deque_t *deque, const void *element)
+{
+	assert(NULL != deque);
+	assert(NULL != element);
+
+	return DequePushBackMany(deque, element, 1);
+}
+
+
+
+int DequePushFront(deque_t *deque, const void *element)
+{
+	assert(NULL != deque);
+	assert(NULL != element);
+
+	return DequePushFrontMany(deque, element, 1);
+}
+
+
+
+void DequePopBack(deque_t *deque)
+{
+	assert(NULL != deque);
+	assert(0 < deque->size);
+
+	--deque->size;
+}
+
+
+
+void DequePopFront(deque_t *deque)
+{
+	assert(NULL != deque);
+	assert(0 < deque->size);
+
+	deque->head = (deque->head + 1) & (deque->capacity - 1);
+	--deque->size;
+}
+
+
+
+/* elements may be taken from the deque itself; the old buffer is freed
+   only after they were copied in */
+int DequePushBackMany(deque_t *deque, const void *elements, size_t count)
+{
+	char *old_buffer = NULL;
+
+	assert(NULL != deque);
+	assert(NULL != elements || 0 == count);
+
+	if (0 != EnsureRoom(deque, count, &old_buffer))
+	{
+		return 1;
+	}
+
+	CopyIn(deque, deque->size, (const char *)elements, count);
+	deque->size += count;
+	free(old_buffer);
+
+	return 0;
+}
+
+
+
+/* the block keeps its order: elements[0] becomes the new front. count
+   calls to DequePushFront would leave it reversed. As with
+   DequePushBackMany, elements may be taken from the deque itself */
+int DequePushFrontMany(deque_t *deque, const void *elements, size_t count)
+{
+	char *old_buffer = NULL;
+
+	assert(NULL != deque);
+	assert(NULL != elements || 0 == count);
+
+	if (0 != EnsureRoom(deque, count, &old_buffer))
+	{
+		return 1;
+	}
+
+	deque->head = (deque->head - count) & (deque->capacity - 1);
+	deque->size += count;
+	CopyIn(deque, 0, (const char *)elements, count);
+	free(old_buffer);
+
+	return 0;
+}
+
+
+
+void DequePopBackMany(deque_t *deque, void *dest, size_t count)
+{
+	assert(NULL != deque);
+	assert(count <= deque->size);
+
+	if (NULL != dest)
+	{
+		CopyOut(deque, deque->size - count, (char *)dest, count);
+	}
+
+	deque->size -= count;
+}
+
+
+
+void DequePopFrontMany(deque_t *deque, void *dest, size_t count)
+{
+	assert(NULL != deque);
+	assert(count <= deque->size);
+
+	if (NULL != dest)
+	{
+		CopyOut(deque, 0, (char *)dest, count);
+	}
+
+	deque->head = (deque->head + count) & (deque->capacity - 1);
+	deque->size -= count;
+}
+
+
+
+void *DequePeekFront(const deque_t *deque)
+{
+	assert(NULL != deque);
+	assert(0 < deque->size);
+
+	return SlotAddress(deque, 0);
+}
+
+
+
+void *DequePeekBack(const deque_t *deque)
+{
+	assert(NULL != deque);
+	assert(0 < deque->size);
+
+	return SlotAddress(deque, deque->size - 1);
+}
+
+
+
+void *DequeGetElement(const deque_t *deque, size_t index)
+{
+	assert(NULL != deque);
+	assert(index < deque->size);
+
+	return SlotAddress(deque, index);
+}
+
+
+
+size_t DequeSize(const deque_t *deque)
+{
+	assert(NULL != deque);
+	return deque->size;
+}
+
+
+
+size_t DequeCapacity(const deque_t *deque)
+{
+	assert(NULL != deque);
+	return deque->capacity;
+}
+
+
+
+int DequeIsEmpty(const deque_t *deque)
+{
+	assert(NULL != deque);
+	return (0 == deque->size);
+}
+
+
+
+void DequeClear(deque_t *deque)
+{
+	assert(NULL != deque);
+
+	deque->head = 0;
+	deque->size = 0;
+}
+
+
+
+int DequeReserve(deque_t *deque, size_t new_capacity)
+{
+	char *old_buffer = NULL;
+	int status = 0;
+
+	assert(NULL != deque);
+
+	status = Grow(deque, new_capacity, &old_buffer);
+	free(old_buffer);
+
+	return status;
+}
+
+
+/**************************************** Helpers *****************************/
+/* the smallest power of two not below capacity, or 0 when it does not fit
+   in a size_t */
+static size_t RoundUpCapacity(size_t capacity)
+{
+	size_t rounded = MIN_CAPACITY;
+
+	while (rounded < capacity)
+	{
+		if (rounded > MAX_SIZE / GROWTH_FACTOR)
+		{
+			return 0;
+		}
+		rounded *= GROWTH_FACTOR;
+	}
+
+	return rounded;
+}
+
+static int EnsureRoom(deque_t *deque, size_t count, char **old_buffer)
+{
+	size_t needed = deque->size + count;
+
+	if (count > MAX_SIZE - deque->size)
+	{
+		return 1;
+	}
+
+	if (needed <= deque->capacity)
+	{
+		return 0;
+	}
+
+	if (deque->capacity <= MAX_SIZE / GROWTH_FACTOR &&
+		needed < deque->capacity * GROWTH_FACTOR)
+	{
+		needed = deque->capacity * GROWTH_FACTOR;
+	}
+
+	return Grow(deque, needed, old_buffer);
+}
+
+/* moves the elements to a bigger buffer and hands the old one to the caller
+   to free, or leaves *old_buffer untouched when nothing had to move */
+static int Grow(deque_t *deque, size_t new_capacity, char **old_buffer)
+{
+	char *new_buffer = NULL;
+
+	if (new_capacity <= deque->capacity)
+	{
+		return 0;
+	}
+
+	new_capacity = RoundUpCapacity(new_capacity);
+	if (0 == new_capacity || new_capacity > MAX_SIZE / deque->element_size)
+	{
+		return 1;
+	}
+
+	new_buffer = (char *)malloc(new_capacity * deque->element_size);
+	if (NULL == new_buffer)
+	{
+		return 1;
+	}
+
+	/* unwrap into the new buffer so the front lands at slot 0 */
+	CopyOut(deque, 0, new_buffer, deque->size);
+	*old_buffer = deque->buffer;
+
+	deque->buffer = new_buffer;
+	deque->capacity = new_capacity;
+	deque->head = 0;
+
+	return 0;
+}
+
+static char *SlotAddress(const deque_t *deque, size_t index)
+{
+	size_t slot = (deque->head + index) & (deque->capacity - 1);
+	return deque->buffer + slot * deque->element_size;
+}
+
+/* copies count elements into logical positions [index, index + count),
+   splitting the copy in two where the range wraps around the buffer end */
+static void CopyIn(deque_t *deque, size_t index, const char *src, size_t count)
+{
+	size_t slot = (deque->head + index) & (deque->capacity - 1);
+	size_t first_part = deque->capacity - slot;
+
+	if (0 == count)
+	{
+		return;
+	}
+
+	if (first_part > count)
+	{
+		first_part = count;
+	}
+
+	memcpy(deque->buffer + slot * deque->element_size, src,
+											first_part * deque->element_size);
+	memcpy(deque->buffer, src + first_part * deque->element_size,
+							(count - first_part) * deque->element_size);
+}
+
+static void CopyOut(const deque_t *deque, size_t index, char *dest, size_t count)
+{
+	size_t slot = (deque->head + index) & (deque->capacity - 1);
+	size_t first_part = deque->capacity - slot;
+
+	if (0 == count)
+	{
+		return;
+	}
+
+	if (first_part > count)
+	{
+		first_part = count;
+	}
+
+	memcpy(dest, deque->buffer + slot * deque->element_size,
+											first_part * deque->element_size);
+	memcpy(dest + first_part * deque->element_size, deque->buffer,
+							(count - first_part) * deque->element_size);
+}
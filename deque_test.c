@@ -0,0 +1,193 @@
+/*
+   Code by: Or Yamin
+   Project: Ring-buffer deque - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+
+#include "deque.h"
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+static int failures = 0;
+
+static void TestBothEnds(void);
+static void TestGrowWhileWrapped(void);
+static void TestMany(void);
+static void TestPushFromItself(void);
+static void TestOverflow(void);
+static int At(const deque_t *deque, size_t index);
+
+
+int main(void)
+{
+	TestBothEnds();
+	TestGrowWhileWrapped();
+	TestMany();
+	TestPushFromItself();
+	TestOverflow();
+
+	if (0 == failures)
+	{
+		puts("deque: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestBothEnds(void)
+{
+	deque_t *deque = DequeCreate(4, sizeof(int));
+	int value = 0;
+
+	CHECK(NULL != deque);
+	CHECK(DequeIsEmpty(deque));
+
+	for (value = 1; value <= 3; ++value)
+	{
+		CHECK(0 == DequePushBack(deque, &value));
+	}
+	value = 0;
+	CHECK(0 == DequePushFront(deque, &value));
+
+	/* 0 1 2 3 */
+	CHECK(4 == DequeSize(deque));
+	CHECK(0 == *(int *)DequePeekFront(deque));
+	CHECK(3 == *(int *)DequePeekBack(deque));
+	CHECK(2 == At(deque, 2));
+
+	DequePopFront(deque);
+	DequePopBack(deque);
+	CHECK(2 == DequeSize(deque));
+	CHECK(1 == *(int *)DequePeekFront(deque));
+	CHECK(2 == *(int *)DequePeekBack(deque));
+
+	DequeClear(deque);
+	CHECK(DequeIsEmpty(deque));
+
+	DequeDestroy(deque);
+}
+
+/* growing must unwrap the ring so the logical order survives */
+static void TestGrowWhileWrapped(void)
+{
+	deque_t *deque = DequeCreate(8, sizeof(int));
+	size_t capacity = DequeCapacity(deque);
+	int value = 0;
+	int i = 0;
+
+	for (i = 0; i < (int)capacity; ++i)
+	{
+		CHECK(0 == DequePushBack(deque, &i));
+	}
+	for (i = 0; i < 3; ++i)
+	{
+		DequePopFront(deque);
+	}
+	for (i = (int)capacity; i < (int)capacity + 3; ++i)
+	{
+		CHECK(0 == DequePushBack(deque, &i));
+	}
+	CHECK(capacity == DequeCapacity(deque));
+
+	value = (int)capacity + 3;
+	CHECK(0 == DequePushBack(deque, &value));
+	CHECK(capacity < DequeCapacity(deque));
+
+	for (i = 0; i < (int)DequeSize(deque); ++i)
+	{
+		CHECK(i + 3 == At(deque, i));
+	}
+
+	DequeDestroy(deque);
+}
+
+static void TestMany(void)
+{
+	deque_t *deque = DequeCreate(2, sizeof(int));
+	int front[] = {1, 2, 3};
+	int back[] = {4, 5, 6, 7};
+	int out[4] = {0};
+	size_t i = 0;
+
+	CHECK(0 == DequePushBackMany(deque, back, 4));
+	CHECK(0 == DequePushFrontMany(deque, front, 3));
+
+	/* the front block keeps its order */
+	CHECK(7 == DequeSize(deque));
+	for (i = 0; i < DequeSize(deque); ++i)
+	{
+		CHECK((int)i + 1 == At(deque, i));
+	}
+
+	DequePopBackMany(deque, out, 2);
+	CHECK(6 == out[0] && 7 == out[1]);
+	DequePopFrontMany(deque, out, 3);
+	CHECK(1 == out[0] && 2 == out[1] && 3 == out[2]);
+	DequePopFrontMany(deque, NULL, 1);
+	CHECK(1 == DequeSize(deque));
+	CHECK(5 == At(deque, 0));
+
+	CHECK(0 == DequePushBackMany(deque, NULL, 0));
+	CHECK(1 == DequeSize(deque));
+
+	DequeDestroy(deque);
+}
+
+/* the pushed elements may live in the buffer that growing replaces */
+static void TestPushFromItself(void)
+{
+	deque_t *deque = DequeCreate(4, sizeof(int));
+	size_t i = 0;
+	int value = 0;
+
+	for (value = 0; value < 4; ++value)
+	{
+		CHECK(0 == DequePushBack(deque, &value));
+	}
+
+	CHECK(0 == DequePushBackMany(deque, DequeGetElement(deque, 0), 4));
+	CHECK(0 == DequePushFrontMany(deque, DequeGetElement(deque, 7), 1));
+
+	/* 3 0 1 2 3 0 1 2 3 */
+	CHECK(9 == DequeSize(deque));
+	for (i = 0; i < DequeSize(deque); ++i)
+	{
+		CHECK((int)((i + 3) % 4) == At(deque, i));
+	}
+
+	DequeDestroy(deque);
+}
+
+static void TestOverflow(void)
+{
+	deque_t *deque = DequeCreate(4, sizeof(int));
+	int value = 1;
+
+	CHECK(NULL == DequeCreate((size_t)-1, sizeof(int)));
+	CHECK(1 == DequeReserve(deque, (size_t)-1 / 2 + 2));
+	CHECK(1 == DequePushBackMany(deque, &value, (size_t)-1));
+	CHECK(0 == DequeSize(deque));
+
+	DequeDestroy(deque);
+}
+
+static int At(const deque_t *deque, size_t index)
+{
+	return *(int *)DequeGetElement(deque, index);
+}
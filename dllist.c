@@ -4,9 +4,14 @@ written by Or Yamin on 19/05/2024
 */
 #include <stdlib.h> /* size_t malloc() free() */
 #include <assert.h> /* assert() */
+#include <pthread.h> /* pthread_create() pthread_join() */
 
 #include "dllist.h"
 
+#define MAX_SORT_BINS 64
+#define MAX_SORT_THREADS 64
+#define PARALLEL_SORT_THRESHOLD 100000
+
 
 struct dllist_node 
 {
@@ -21,10 +26,23 @@ struct dllist
     struct dllist_node *tail;
 };
 
+struct sort_job
+{
+    struct dllist_node *chain;
+    dllist_cmp_func_t cmp;
+};
+
 
 
 static dllist_iter_t CreateNode(dllist_iter_t next, dllist_iter_t prev, void* data);
 static int counter(void *data, void *param);
+static struct dllist_node *MergeChains(struct dllist_node *first, 
+						struct dllist_node *second, dllist_cmp_func_t cmp);
+static struct dllist_node *SortChain(struct dllist_node *chain, 
+													dllist_cmp_func_t cmp);
+static void *SortJob(void *job);
+static struct dllist_node *DetachChain(dllist_t *list);
+static void AttachChain(dllist_t *list, struct dllist_node *chain);
 
 
 dllist_t *DllistCreate(void)
@@ -317,6 +335,101 @@ int DllistMultiFind(dllist_iter_t from, dllist_iter_t to, match_func_t is_match,
 
 
 
+void DllistSort(dllist_t *list, dllist_cmp_func_t cmp)
+{
+	assert(NULL != list);
+	assert(NULL != cmp);
+	
+	AttachChain(list, SortChain(DetachChain(list), cmp));
+}
+
+
+
+void DllistSortParallel(dllist_t *list, dllist_cmp_func_t cmp, size_t num_threads)
+{
+	pthread_t threads[MAX_SORT_THREADS];
+	int is_started[MAX_SORT_THREADS];
+	struct sort_job jobs[MAX_SORT_THREADS];
+	struct dllist_node *runner = NULL;
+	struct dllist_node *piece_end = NULL;
+	size_t size = 0;
+	size_t piece_size = 0;
+	size_t i = 0;
+	size_t j = 0;
+	size_t step = 0;
+	
+	assert(NULL != list);
+	assert(NULL != cmp);
+	
+	if (MAX_SORT_THREADS < num_threads)
+	{
+		num_threads = MAX_SORT_THREADS;
+	}
+	
+	size = DllistSize(list);
+	if (num_threads < 2 || size < PARALLEL_SORT_THRESHOLD)
+	{
+		DllistSort(list, cmp);
+		return;
+	}
+	
+	/* cut the chain into num_threads pieces of about equal length */
+	piece_size = (size + num_threads - 1) / num_threads;
+	runner = DetachChain(list);
+	for (i = 0; i < num_threads; ++i)
+	{
+		jobs[i].chain = runner;
+		jobs[i].cmp = cmp;
+		
+		for (j = 1, piece_end = runner; NULL != piece_end && j < piece_size; ++j)
+		{
+			piece_end = piece_end->next;
+		}
+		
+		if (NULL != piece_end)
+		{
+			runner = piece_end->next;
+			piece_end->next = NULL;
+		}
+		else
+		{
+			runner = NULL;
+		}
+	}
+	
+	/* a piece whose thread fails to start is sorted right here */
+	for (i = 0; i < num_threads; ++i)
+	{
+		is_started[i] = (0 == pthread_create(&threads[i], NULL, SortJob, &jobs[i]));
+		if (!is_started[i])
+		{
+			SortJob(&jobs[i]);
+		}
+	}
+	
+	for (i = 0; i < num_threads; ++i)
+	{
+		if (is_started[i])
+		{
+			pthread_join(threads[i], NULL);
+		}
+	}
+	
+	/* merge neighbouring pieces pairwise, keeping the order stable */
+	for (step = 1; step < num_threads; step *= 2)
+	{
+		for (i = 0; i + step < num_threads; i += 2 * step)
+		{
+			jobs[i].chain = MergeChains(jobs[i].chain, jobs[i + step].chain, cmp);
+		}
+	}
+	
+	AttachChain(list, jobs[0].chain);
+}
+
+
+
+
 static dllist_iter_t CreateNode(dllist_iter_t next, dllist_iter_t prev, void* data)
 {
 	dllist_iter_t node = (dllist_iter_t)malloc(sizeof(struct dllist_node));
@@ -343,3 +456,115 @@ static int counter(void *data, void *param)
 	return 1;
 }
 
+
+
+/* stable merge of two NULL terminated chains linked through next only;
+   on equal keys the node from first comes out first */
+static struct dllist_node *MergeChains(struct dllist_node *first, 
+						struct dllist_node *second, dllist_cmp_func_t cmp)
+{
+	struct dllist_node *merged = NULL;
+	struct dllist_node **tail = &merged;
+	
+	while (NULL != first && NULL != second)
+	{
+		if (0 > cmp(second->data, first->data))
+		{
+			*tail = second;
+			second = second->next;
+		}
+		else
+		{
+			*tail = first;
+			first = first->next;
+		}
+		tail = &(*tail)->next;
+	}
+	
+	*tail = (NULL != first) ? first : second;
+	
+	return merged;
+}
+
+
+
+/* bottom-up merge sort: bins[i] holds a sorted run of 2^i nodes, and
+   adding a node carries through the bins like a binary counter */
+static struct dllist_node *SortChain(struct dllist_node *chain, 
+													dllist_cmp_func_t cmp)
+{
+	struct dllist_node *bins[MAX_SORT_BINS] = {NULL};
+	struct dllist_node *run = NULL;
+	size_t i = 0;
+	
+	while (NULL != chain)
+	{
+		run = chain;
+		chain = chain->next;
+		run->next = NULL;
+		
+		for (i = 0; i < MAX_SORT_BINS - 1 && NULL != bins[i]; ++i)
+		{
+			run = MergeChains(bins[i], run, cmp);
+			bins[i] = NULL;
+		}
+		
+		bins[i] = MergeChains(bins[i], run, cmp);
+	}
+	
+	for (i = 0, run = NULL; i < MAX_SORT_BINS; ++i)
+	{
+		run = MergeChains(bins[i], run, cmp);
+	}
+	
+	return run;
+}
+
+
+
+static void *SortJob(void *job)
+{
+	struct sort_job *sort_job = (struct sort_job *)job;
+	
+	sort_job->chain = SortChain(sort_job->chain, sort_job->cmp);
+	
+	return NULL;
+}
+
+
+
+/* unhooks all the elements as a NULL terminated chain; the list is left
+   empty and prev pointers are rebuilt by AttachChain */
+static struct dllist_node *DetachChain(dllist_t *list)
+{
+	struct dllist_node *chain = NULL;
+	
+	if (DllistIsEmpty(list))
+	{
+		return NULL;
+	}
+	
+	chain = list->head->next;
+	list->tail->prev->next = NULL;
+	list->head->next = list->tail;
+	list->tail->prev = list->head;
+	
+	return chain;
+}
+
+
+
+static void AttachChain(dllist_t *list, struct dllist_node *chain)
+{
+	struct dllist_node *prev = list->head;
+	
+	for (; NULL != chain; chain = chain->next)
+	{
+		prev->next = chain;
+		chain->prev = prev;
+		prev = chain;
+	}
+	
+	prev->next = list->tail;
+	list->tail->prev = prev;
+}
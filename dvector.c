@@ -2,11 +2,13 @@
 written by Or Yamin on 06/05/2024*/
 
 #include <stdlib.h> /* malloc, realloc, free */
+#include <string.h> /* memcpy, memmove, memset */
 #include <assert.h> /* assert */
 
 #include "dvector.h"
 
 #define GROWTH_FACTOR 2
+#define MAX_SIZE ((size_t)-1)
 
 struct dvector 
 {
@@ -18,6 +20,8 @@ struct dvector
 
 
 static int IsDvectorFull(size_t capacity, size_t size);
+static int EnsureRoom(dvector_t *vector, size_t count);
+static char *ElementAt(const dvector_t *vector, size_t index);
 
 
 dvector_t *DvectorCreate(size_t capacity, size_t element_size) 
@@ -34,7 +38,11 @@ dvector_t *DvectorCreate(size_t capacity, size_t element_size)
 	vector->size = 0;
 	vector->capacity = capacity;
 	vector->element_size = element_size;
-	vector->buffer = (char *)malloc(capacity * element_size * sizeof(char));
+	vector->buffer = NULL;
+	if (capacity <= MAX_SIZE / element_size)
+	{
+		vector->buffer = (char *)malloc(capacity * element_size * sizeof(char));
+	}
 	if (NULL == vector->buffer) 
     {
         free(vector);
@@ -52,26 +60,113 @@ void DvectorDestroy(dvector_t *vector)
 
 int DvectorPushBack(dvector_t *vector, const void *new_element) 
 {
-	char *temp_p = NULL;
-	size_t size_element = vector->size * vector->element_size;
-	size_t i = 0;
-	
 	assert(NULL != vector);
 	assert(NULL != new_element);
 	
-	temp_p = (char *)new_element;
+	if (IsDvectorFull(vector->size, vector->capacity) && 
+		0 != EnsureRoom(vector, 1))
+	{
+		return 1;
+	}
+	
+	memcpy(ElementAt(vector, vector->size), new_element, vector->element_size);
+	++vector->size;
 
-	if (IsDvectorFull(vector->size, vector->capacity))
+	return 0;
+}
+
+/* elements is an array of count elements; on failure nothing is added */
+int DvectorPushBackMany(dvector_t *vector, const void *elements, size_t count) 
+{
+	assert(NULL != vector);
+	
+	return DvectorInsertRange(vector, vector->size, elements, count);
+}
+
+/* elements must not point into vector's own buffer, which may move */
+int DvectorInsertRange(dvector_t *vector, size_t index, const void *elements, 
+																size_t count) 
+{
+	assert(NULL != vector);
+	assert(NULL != elements || 0 == count);
+	assert(index <= vector->size);
+	
+	if (0 == count)
 	{
-		DvectorReserve(vector, vector->size * GROWTH_FACTOR);
+		return 0;
 	}
 	
-	for( i = 0; i < vector->element_size; i++ , temp_p++)
+	if (0 != EnsureRoom(vector, count))
 	{
-		*(vector->buffer + size_element + i) = *temp_p;
+		return 1;
 	}
-	++vector->size;
+	
+	memmove(ElementAt(vector, index + count), ElementAt(vector, index), 
+						(vector->size - index) * vector->element_size);
+	memcpy(ElementAt(vector, index), elements, count * vector->element_size);
+	vector->size += count;
+	
+	return 0;
+}
+
+/* removes the elements in [from, to) and closes the gap */
+void DvectorEraseRange(dvector_t *vector, size_t from, size_t to) 
+{
+	assert(NULL != vector);
+	assert(from <= to);
+	assert(to <= vector->size);
+	
+	memmove(ElementAt(vector, from), ElementAt(vector, to), 
+						(vector->size - to) * vector->element_size);
+	vector->size -= to - from;
+}
+
+/* new elements are zero-filled; shrinking keeps the capacity */
+int DvectorResize(dvector_t *vector, size_t new_size) 
+{
+	assert(NULL != vector);
+	
+	if (new_size > vector->size)
+	{
+		if (0 != EnsureRoom(vector, new_size - vector->size))
+		{
+			return 1;
+		}
+		
+		memset(ElementAt(vector, vector->size), 0, 
+						(new_size - vector->size) * vector->element_size);
+	}
+	
+	vector->size = new_size;
+	
+	return 0;
+}
 
+/* src may be dest itself */
+int DvectorAppendVector(dvector_t *dest, const dvector_t *src) 
+{
+	size_t count = 0;
+	
+	assert(NULL != dest);
+	assert(NULL != src);
+	assert(dest->element_size == src->element_size);
+	
+	count = src->size;
+	if (0 == count)
+	{
+		return 0;
+	}
+	
+	if (0 != EnsureRoom(dest, count))
+	{
+		return 1;
+	}
+	
+	/* src's buffer is read only after the reserve, in case it is dest's */
+	memcpy(ElementAt(dest, dest->size), src->buffer, 
+										count * src->element_size);
+	dest->size += count;
+	
 	return 0;
 }
 
@@ -93,11 +188,18 @@ int DvectorReserve(dvector_t *vector, size_t new_size)
 	char *new_buffer;
 	assert(NULL != vector);
 	
+	if (new_size > MAX_SIZE / vector->element_size)
+	{
+		return 1;
+	}
+	
+	/* realloc to 0 bytes may free the buffer and return NULL, so an empty
+	   vector keeps room for one element */
 	new_buffer = (char *)realloc(vector->buffer,
-												new_size*vector->element_size);
+						(0 == new_size ? 1 : new_size) * vector->element_size);
 	if (!new_buffer) 
 	{
-		return -1;
+		return 1;
 	}
 	
 	
@@ -136,3 +238,34 @@ static int IsDvectorFull(size_t size, size_t capacity)
 {
 	return (capacity == size);
 }
+
+/* makes room for count more elements; grows geometrically, so a run of
+   single pushes stays amortized O(1). Fails if the size would overflow */
+static int EnsureRoom(dvector_t *vector, size_t count)
+{
+	size_t needed = vector->size + count;
+	size_t new_capacity = needed;
+	
+	if (count > MAX_SIZE - vector->size)
+	{
+		return 1;
+	}
+	
+	if (needed <= vector->capacity)
+	{
+		return 0;
+	}
+	
+	if (vector->capacity <= MAX_SIZE / GROWTH_FACTOR && 
+		needed < vector->capacity * GROWTH_FACTOR)
+	{
+		new_capacity = vector->capacity * GROWTH_FACTOR;
+	}
+	
+	return DvectorReserve(vector, new_capacity);
+}
+
+static char *ElementAt(const dvector_t *vector, size_t index)
+{
+	return vector->buffer + index * vector->element_size;
+}
@@ -0,0 +1,237 @@
+/*
+   Code by: Or Yamin
+   Project: type-specialized dynamic vectors (macro template)
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* DVECTOR_DECLARE(type, suffix) emits a dynamic vector of type with the same
+   operations as dvector.c, named after the suffix:
+
+       DVECTOR_DECLARE(int32_t, i32)
+
+       dvector_i32_t *v = DvectorCreate_i32(16);
+       DvectorPushBack_i32(v, 42);
+       x = DvectorGet_i32(v, 0);
+
+   The struct is visible and every function is DVECTOR_INLINE, so element
+   access compiles to plain array indexing with the element size known at
+   compile time, and copies are assignments the compiler can vectorize.
+   Use it for hot vectors of numbers or small structs; the generic dvector
+   stays the choice for element sizes only known at run time.
+
+   Expand the macro once per type in each file that uses it. */
+
+#ifndef __DVECTOR_TYPED_H__
+#define __DVECTOR_TYPED_H__
+
+#include <stdlib.h> /* size_t malloc realloc free */
+#include <string.h> /* memcpy */
+#include <assert.h> /* assert */
+
+#define DVECTOR_TYPED_GROWTH_FACTOR 2
+#define DVECTOR_TYPED_MAX_SIZE ((size_t)-1)
+
+/* inline is C99; GNU compilers take __inline__ in C89 mode as well, and
+   anything else gets plain static functions. Define it first to override */
+#ifndef DVECTOR_INLINE
+#if defined(__GNUC__)
+#define DVECTOR_INLINE static __inline__
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define DVECTOR_INLINE static inline
+#else
+#define DVECTOR_INLINE static
+#endif
+#endif
+
+#define DVECTOR_DECLARE(type, suffix) \
+\
+typedef struct dvector_##suffix \
+{ \
+	type *data; \
+	size_t size; \
+	size_t capacity; \
+} dvector_##suffix##_t; \
+\
+DVECTOR_INLINE int DvectorReserve_##suffix(dvector_##suffix##_t *vector, \
+															size_t capacity) \
+{ \
+	type *new_data = NULL; \
+	\
+	assert(NULL != vector); \
+	\
+	if (capacity > DVECTOR_TYPED_MAX_SIZE / sizeof(type)) \
+	{ \
+		return 1; \
+	} \
+	\
+	/* 1 keeps realloc from freeing the buffer on a request for 0 */ \
+	new_data = (type *)realloc(vector->data, \
+							(0 == capacity ? 1 : capacity) * sizeof(type)); \
+	if (NULL == new_data) \
+	{ \
+		return 1; \
+	} \
+	\
+	vector->data = new_data; \
+	vector->capacity = capacity; \
+	if (vector->size > capacity) \
+	{ \
+		vector->size = capacity; \
+	} \
+	\
+	return 0; \
+} \
+\
+DVECTOR_INLINE dvector_##suffix##_t *DvectorCreate_##suffix(size_t capacity) \
+{ \
+	dvector_##suffix##_t *vector = (dvector_##suffix##_t *)malloc( \
+											sizeof(dvector_##suffix##_t)); \
+	if (NULL == vector) \
+	{ \
+		return NULL; \
+	} \
+	\
+	vector->data = NULL; \
+	vector->size = 0; \
+	vector->capacity = 0; \
+	\
+	if (0 != DvectorReserve_##suffix(vector, capacity)) \
+	{ \
+		free(vector); \
+		return NULL; \
+	} \
+	\
+	return vector; \
+} \
+\
+DVECTOR_INLINE void DvectorDestroy_##suffix(dvector_##suffix##_t *vector) \
+{ \
+	assert(NULL != vector); \
+	\
+	free(vector->data); \
+	free(vector); \
+} \
+\
+/* the slow path of the pushes */ \
+DVECTOR_INLINE int DvectorGrow_##suffix(dvector_##suffix##_t *vector, \
+														size_t min_capacity) \
+{ \
+	size_t new_capacity = min_capacity; \
+	\
+	if (vector->capacity <= DVECTOR_TYPED_MAX_SIZE / \
+									DVECTOR_TYPED_GROWTH_FACTOR && \
+		new_capacity < vector->capacity * DVECTOR_TYPED_GROWTH_FACTOR) \
+	{ \
+		new_capacity = vector->capacity * DVECTOR_TYPED_GROWTH_FACTOR; \
+	} \
+	\
+	return DvectorReserve_##suffix(vector, new_capacity); \
+} \
+\
+DVECTOR_INLINE int DvectorPushBack_##suffix(dvector_##suffix##_t *vector, \
+																type value) \
+{ \
+	assert(NULL != vector); \
+	\
+	if (vector->size == vector->capacity && \
+		0 != DvectorGrow_##suffix(vector, vector->size + 1)) \
+	{ \
+		return 1; \
+	} \
+	\
+	vector->data[vector->size] = value; \
+	++vector->size; \
+	\
+	return 0; \
+} \
+\
+DVECTOR_INLINE int DvectorPushBackMany_##suffix( \
+				dvector_##suffix##_t *vector, const type *values, size_t count) \
+{ \
+	assert(NULL != vector); \
+	assert(NULL != values || 0 == count); \
+	\
+	if (count > DVECTOR_TYPED_MAX_SIZE / sizeof(type) - vector->size) \
+	{ \
+		return 1; \
+	} \
+	\
+	if (count > vector->capacity - vector->size && \
+		0 != DvectorGrow_##suffix(vector, vector->size + count)) \
+	{ \
+		return 1; \
+	} \
+	\
+	if (0 < count) \
+	{ \
+		memcpy(vector->data + vector->size, values, count * sizeof(type)); \
+	} \
+	vector->size += count; \
+	\
+	return 0; \
+} \
+\
+DVECTOR_INLINE void DvectorPopBack_##suffix(dvector_##suffix##_t *vector) \
+{ \
+	assert(NULL != vector); \
+	assert(0 < vector->size); \
+	\
+	--vector->size; \
+} \
+\
+DVECTOR_INLINE type DvectorGet_##suffix(const dvector_##suffix##_t *vector, \
+																size_t index) \
+{ \
+	assert(NULL != vector); \
+	assert(index < vector->size); \
+	\
+	return vector->data[index]; \
+} \
+\
+DVECTOR_INLINE void DvectorSet_##suffix(dvector_##suffix##_t *vector, \
+													size_t index, type value) \
+{ \
+	assert(NULL != vector); \
+	assert(index < vector->size); \
+	\
+	vector->data[index] = value; \
+} \
+\
+/* the elements as a plain array; valid until the vector grows */ \
+DVECTOR_INLINE type *DvectorData_##suffix(dvector_##suffix##_t *vector) \
+{ \
+	assert(NULL != vector); \
+	return vector->data; \
+} \
+\
+DVECTOR_INLINE size_t DvectorSize_##suffix( \
+										const dvector_##suffix##_t *vector) \
+{ \
+	assert(NULL != vector); \
+	return vector->size; \
+} \
+\
+DVECTOR_INLINE size_t DvectorCapacity_##suffix( \
+										const dvector_##suffix##_t *vector) \
+{ \
+	assert(NULL != vector); \
+	return vector->capacity; \
+} \
+\
+DVECTOR_INLINE void DvectorClear_##suffix(dvector_##suffix##_t *vector) \
+{ \
+	assert(NULL != vector); \
+	vector->size = 0; \
+} \
+\
+DVECTOR_INLINE int DvectorShrink_##suffix(dvector_##suffix##_t *vector) \
+{ \
+	assert(NULL != vector); \
+	return DvectorReserve_##suffix(vector, vector->size); \
+}
+
+#endif /* __DVECTOR_TYPED_H__ */
@@ -0,0 +1,226 @@
+/*
+   Code by: Or Yamin
+   Project: type-specialized dynamic vectors (macro template) - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <pthread.h> /* pthread_create() pthread_join() */
+
+#include "dvector_typed.h"
+
+#define ITEMS 10000
+#define THREADS 4
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+struct point
+{
+	double x;
+	double y;
+};
+
+DVECTOR_DECLARE(int, int)
+DVECTOR_DECLARE(struct point, point)
+
+struct worker_arg
+{
+	int first_value;
+	int errors;
+};
+
+static int failures = 0;
+
+static void TestPushGet(void);
+static void TestPushManyReserve(void);
+static void TestStructs(void);
+static void TestOverflow(void);
+static void TestThreads(void);
+static void *Work(void *arg);
+
+
+int main(void)
+{
+	TestPushGet();
+	TestPushManyReserve();
+	TestStructs();
+	TestOverflow();
+	TestThreads();
+
+	if (0 == failures)
+	{
+		puts("dvector_typed: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestPushGet(void)
+{
+	dvector_int_t *vector = DvectorCreate_int(0);
+	int *data = NULL;
+	size_t i = 0;
+
+	CHECK(NULL != vector);
+	CHECK(0 == DvectorSize_int(vector));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		CHECK(0 == DvectorPushBack_int(vector, (int)i));
+	}
+	CHECK(ITEMS == DvectorSize_int(vector));
+	CHECK(ITEMS <= DvectorCapacity_int(vector));
+
+	data = DvectorData_int(vector);
+	for (i = 0; i < ITEMS; ++i)
+	{
+		CHECK((int)i == DvectorGet_int(vector, i));
+		CHECK((int)i == data[i]);
+	}
+
+	DvectorSet_int(vector, 5, -5);
+	CHECK(-5 == DvectorGet_int(vector, 5));
+
+	DvectorPopBack_int(vector);
+	CHECK(ITEMS - 1 == DvectorSize_int(vector));
+	CHECK(ITEMS - 2 == DvectorGet_int(vector, ITEMS - 2));
+
+	DvectorClear_int(vector);
+	CHECK(0 == DvectorSize_int(vector));
+	CHECK(0 == DvectorShrink_int(vector));
+	CHECK(0 == DvectorCapacity_int(vector));
+
+	/* a vector shrunk to nothing can grow again */
+	CHECK(0 == DvectorPushBack_int(vector, 1));
+	CHECK(1 == DvectorGet_int(vector, 0));
+
+	DvectorDestroy_int(vector);
+}
+
+static void TestPushManyReserve(void)
+{
+	dvector_int_t *vector = DvectorCreate_int(4);
+	int values[100];
+	size_t i = 0;
+
+	for (i = 0; i < 100; ++i)
+	{
+		values[i] = (int)i * 3;
+	}
+
+	CHECK(0 == DvectorPushBackMany_int(vector, values, 0));
+	CHECK(0 == DvectorPushBackMany_int(vector, values, 3));
+	CHECK(0 == DvectorPushBackMany_int(vector, values, 100));
+	CHECK(103 == DvectorSize_int(vector));
+	CHECK(6 == DvectorGet_int(vector, 2));
+	CHECK(297 == DvectorGet_int(vector, 102));
+
+	CHECK(0 == DvectorReserve_int(vector, 1000));
+	CHECK(1000 == DvectorCapacity_int(vector));
+	CHECK(297 == DvectorGet_int(vector, 102));
+
+	/* reserving below the size cuts the vector down */
+	CHECK(0 == DvectorReserve_int(vector, 10));
+	CHECK(10 == DvectorSize_int(vector));
+	CHECK(18 == DvectorGet_int(vector, 9));
+
+	DvectorDestroy_int(vector);
+}
+
+static void TestStructs(void)
+{
+	dvector_point_t *vector = DvectorCreate_point(2);
+	struct point point = {0, 0};
+	size_t i = 0;
+
+	for (i = 0; i < 100; ++i)
+	{
+		point.x = (double)i;
+		point.y = -(double)i;
+		DvectorPushBack_point(vector, point);
+	}
+
+	point = DvectorGet_point(vector, 42);
+	CHECK(42.0 == point.x && -42.0 == point.y);
+
+	DvectorData_point(vector)[42].y = 1.5;
+	CHECK(1.5 == DvectorGet_point(vector, 42).y);
+
+	DvectorDestroy_point(vector);
+}
+
+/* sizes whose byte count does not fit in size_t fail instead of wrapping */
+static void TestOverflow(void)
+{
+	dvector_point_t *vector = DvectorCreate_point(1);
+	struct point point = {1, 2};
+
+	CHECK(NULL == DvectorCreate_point((size_t)-1 / 2));
+	CHECK(1 == DvectorReserve_point(vector, (size_t)-1 / 8));
+
+	DvectorPushBack_point(vector, point);
+	CHECK(1 == DvectorPushBackMany_point(vector, &point, (size_t)-1));
+	CHECK(1 == DvectorSize_point(vector));
+	CHECK(2.0 == DvectorGet_point(vector, 0).y);
+
+	DvectorDestroy_point(vector);
+}
+
+/* there is no shared state between vectors, so threads that each own one
+   do not disturb each other */
+static void TestThreads(void)
+{
+	pthread_t threads[THREADS];
+	struct worker_arg args[THREADS];
+	int i = 0;
+
+	for (i = 0; i < THREADS; ++i)
+	{
+		args[i].first_value = i * ITEMS;
+		args[i].errors = 0;
+		pthread_create(&threads[i], NULL, Work, &args[i]);
+	}
+	for (i = 0; i < THREADS; ++i)
+	{
+		pthread_join(threads[i], NULL);
+		CHECK(0 == args[i].errors);
+	}
+}
+
+static void *Work(void *arg)
+{
+	struct worker_arg *worker = (struct worker_arg *)arg;
+	dvector_int_t *vector = DvectorCreate_int(1);
+	size_t i = 0;
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		DvectorPushBack_int(vector, worker->first_value + (int)i);
+	}
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		if (worker->first_value + (int)i != DvectorGet_int(vector, i))
+		{
+			++worker->errors;
+		}
+	}
+
+	DvectorDestroy_int(vector);
+
+	return NULL;
+}
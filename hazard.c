@@ -0,0 +1,492 @@
+/*
+   Code by: Or Yamin
+   Project: Hazard pointers (safe memory reclamation)
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdlib.h> /* malloc realloc free size_t */
+#include <assert.h> /* assert */
+#include <pthread.h> /* pthread_key_t pthread_getspecific pthread_setspecific */
+
+#include "hazard.h"
+
+#define RETIRE_THRESHOLD 64
+#define MAX_CACHED_BLOCKS 256
+#define GROWTH_FACTOR 2
+
+/* record states */
+#define RECORD_FREE 0
+#define RECORD_OWNED 1
+#define RECORD_ORPHANED 2 /* its domain is gone; the owner frees it */
+
+/* A record is owned by one thread at a time; other threads only read its
+   slots while scanning. Records are never freed before the domain is.
+   Every thread keeps the records it owns, one per domain, in a thread-local
+   list. A single process-wide key points at that list only so it can be
+   released when the thread exits, so the number of domains is not capped
+   by PTHREAD_KEYS_MAX. */
+struct hazard_record
+{
+	void **slots;
+	size_t num_slots;
+	void **retired;
+	size_t retired_count;
+	size_t retired_capacity;
+	void *cached_blocks;
+	size_t cached_count;
+	int state;
+	hazard_domain_t *domain;
+	struct hazard_record *next;
+	struct hazard_record *owned_next;
+};
+
+struct hazard_domain
+{
+	hazard_record_t *records;
+	size_t slots_per_record;
+	void (*free_func)(void *block);
+};
+
+static pthread_key_t owned_key;
+static pthread_once_t owned_key_once = PTHREAD_ONCE_INIT;
+static int owned_key_status = 0;
+static __thread hazard_record_t *owned_records = NULL;
+
+static void CreateOwnedKey(void);
+static hazard_record_t *FindOwned(const hazard_domain_t *domain);
+static void DisownRecords(const hazard_domain_t *domain);
+static hazard_record_t *CreateRecord(hazard_domain_t *domain);
+static void ReleaseRecord(hazard_record_t *record);
+static void ReleaseOwned(void *records);
+static void FreeRecord(hazard_record_t *record);
+static void Scan(hazard_record_t *record);
+static int IsHazard(const hazard_domain_t *domain, const void *block);
+static void CacheBlock(hazard_record_t *record, void *block);
+static void FreeBlock(void *block);
+
+
+hazard_domain_t *HazardDomainCreate(size_t slots_per_record,
+												void (*free_func)(void *block))
+{
+	hazard_domain_t *domain = NULL;
+
+	assert(0 < slots_per_record);
+
+	domain = (hazard_domain_t *)malloc(sizeof(hazard_domain_t));
+	if (NULL == domain)
+	{
+		return NULL;
+	}
+
+	pthread_once(&owned_key_once, CreateOwnedKey);
+	if (0 != owned_key_status)
+	{
+		free(domain);
+		return NULL;
+	}
+
+	domain->records = NULL;
+	domain->slots_per_record = slots_per_record;
+	domain->free_func = (NULL == free_func) ? FreeBlock : free_func;
+
+	return domain;
+}
+
+
+
+void HazardDomainDestroy(hazard_domain_t *domain)
+{
+	hazard_record_t *record = NULL;
+	hazard_record_t *next = NULL;
+	void *block = NULL;
+	int owned = RECORD_OWNED;
+	size_t i = 0;
+
+	assert(NULL != domain);
+
+	DisownRecords(domain);
+
+	for (record = domain->records; NULL != record; record = next)
+	{
+		next = record->next;
+
+		for (i = 0; i < record->retired_count; ++i)
+		{
+			domain->free_func(record->retired[i]);
+		}
+
+		while (NULL != record->cached_blocks)
+		{
+			block = record->cached_blocks;
+			record->cached_blocks = *(void **)block;
+			domain->free_func(block);
+		}
+
+		free(record->retired);
+		record->retired = NULL;
+		record->retired_count = 0;
+
+		/* another live thread still lists this record; it frees it the next
+		   time it acquires a record, or when it exits */
+		owned = RECORD_OWNED;
+		if (!__atomic_compare_exchange_n(&record->state, &owned,
+						RECORD_ORPHANED, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			FreeRecord(record);
+		}
+	}
+
+	free(domain);
+}
+
+
+
+hazard_record_t *HazardAcquire(hazard_domain_t *domain)
+{
+	hazard_record_t *record = NULL;
+	int inactive = RECORD_FREE;
+
+	assert(NULL != domain);
+
+	record = FindOwned(domain);
+	if (NULL != record)
+	{
+		return record;
+	}
+
+	/* reuse a record left behind by a thread that exited */
+	record = __atomic_load_n(&domain->records, __ATOMIC_ACQUIRE);
+	for (; NULL != record; record = record->next)
+	{
+		inactive = RECORD_FREE;
+		if (RECORD_FREE == __atomic_load_n(&record->state, __ATOMIC_RELAXED) &&
+			__atomic_compare_exchange_n(&record->state, &inactive,
+					RECORD_OWNED, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+		{
+			break;
+		}
+	}
+
+	if (NULL == record)
+	{
+		record = CreateRecord(domain);
+		if (NULL == record)
+		{
+			return NULL;
+		}
+	}
+
+	/* the key only has to know where the list is; setting it again for a
+	   thread that already has it is harmless */
+	if (NULL == owned_records &&
+		0 != pthread_setspecific(owned_key, &owned_records))
+	{
+		ReleaseRecord(record);
+		return NULL;
+	}
+
+	record->owned_next = owned_records;
+	owned_records = record;
+
+	return record;
+}
+
+
+
+void *HazardProtect(hazard_record_t *record, size_t slot, void **src)
+{
+	void *ptr = NULL;
+
+	assert(NULL != record);
+	assert(NULL != src);
+	assert(slot < record->num_slots);
+
+	do
+	{
+		ptr = __atomic_load_n(src, __ATOMIC_ACQUIRE);
+		__atomic_store_n(&record->slots[slot], ptr, __ATOMIC_SEQ_CST);
+	}
+	while (ptr != __atomic_load_n(src, __ATOMIC_SEQ_CST));
+
+	return ptr;
+}
+
+
+
+void HazardSet(hazard_record_t *record, size_t slot, void *ptr)
+{
+	assert(NULL != record);
+	assert(slot < record->num_slots);
+
+	__atomic_store_n(&record->slots[slot], ptr, __ATOMIC_SEQ_CST);
+}
+
+
+
+void HazardClear(hazard_record_t *record)
+{
+	size_t i = 0;
+
+	assert(NULL != record);
+
+	for (i = 0; i < record->num_slots; ++i)
+	{
+		__atomic_store_n(&record->slots[i], NULL, __ATOMIC_RELEASE);
+	}
+}
+
+
+
+int HazardRetire(hazard_record_t *record, void *block)
+{
+	void **new_retired = NULL;
+	size_t new_capacity = 0;
+
+	assert(NULL != record);
+	assert(NULL != block);
+
+	if (record->retired_count == record->retired_capacity)
+	{
+		Scan(record);
+	}
+
+	/* every survivor is still protected by some thread - make room */
+	if (record->retired_count == record->retired_capacity)
+	{
+		new_capacity = record->retired_capacity * GROWTH_FACTOR;
+		new_retired = (void **)realloc(record->retired,
+												new_capacity * sizeof(void *));
+		if (NULL == new_retired)
+		{
+			return 1;
+		}
+
+		record->retired = new_retired;
+		record->retired_capacity = new_capacity;
+	}
+
+	record->retired[record->retired_count] = block;
+	++record->retired_count;
+
+	return 0;
+}
+
+
+
+void *HazardGetBlock(hazard_record_t *record)
+{
+	void *block = NULL;
+
+	assert(NULL != record);
+
+	block = record->cached_blocks;
+	if (NULL != block)
+	{
+		record->cached_blocks = *(void **)block;
+		--record->cached_count;
+	}
+
+	return block;
+}
+
+
+/**************************************** Helpers *****************************/
+static void CreateOwnedKey(void)
+{
+	owned_key_status = pthread_key_create(&owned_key, ReleaseOwned);
+}
+
+/* frees the orphans met on the way, so a thread that outlives many domains
+   does not keep their records: new records go to the front, so every miss
+   walks, and purges, the whole list. An orphan may also name a freed domain
+   whose address was reused */
+static hazard_record_t *FindOwned(const hazard_domain_t *domain)
+{
+	hazard_record_t **link = &owned_records;
+	hazard_record_t *record = NULL;
+
+	while (NULL != (record = *link))
+	{
+		if (RECORD_ORPHANED == __atomic_load_n(&record->state, __ATOMIC_ACQUIRE))
+		{
+			*link = record->owned_next;
+			FreeRecord(record);
+			continue;
+		}
+
+		if (domain == record->domain)
+		{
+			return record;
+		}
+		link = &record->owned_next;
+	}
+
+	return NULL;
+}
+
+/* a domain being destroyed takes its records back from the destroying
+   thread right away, instead of orphaning them */
+static void DisownRecords(const hazard_domain_t *domain)
+{
+	hazard_record_t **link = &owned_records;
+	hazard_record_t *record = NULL;
+
+	while (NULL != (record = *link))
+	{
+		if (domain == record->domain)
+		{
+			*link = record->owned_next;
+			HazardClear(record);
+			__atomic_store_n(&record->state, RECORD_FREE, __ATOMIC_RELEASE);
+			continue;
+		}
+
+		link = &record->owned_next;
+	}
+}
+
+static hazard_record_t *CreateRecord(hazard_domain_t *domain)
+{
+	hazard_record_t *record = NULL;
+	hazard_record_t *head = NULL;
+
+	record = (hazard_record_t *)malloc(sizeof(hazard_record_t));
+	if (NULL == record)
+	{
+		return NULL;
+	}
+
+	record->slots = (void **)calloc(domain->slots_per_record, sizeof(void *));
+	if (NULL == record->slots)
+	{
+		free(record);
+		return NULL;
+	}
+
+	record->retired = (void **)malloc(RETIRE_THRESHOLD * sizeof(void *));
+	if (NULL == record->retired)
+	{
+		free(record->slots);
+		free(record);
+		return NULL;
+	}
+
+	record->num_slots = domain->slots_per_record;
+	record->retired_count = 0;
+	record->retired_capacity = RETIRE_THRESHOLD;
+	record->cached_blocks = NULL;
+	record->cached_count = 0;
+	record->state = RECORD_OWNED;
+	record->domain = domain;
+	record->owned_next = NULL;
+
+	head = __atomic_load_n(&domain->records, __ATOMIC_RELAXED);
+	do
+	{
+		record->next = head;
+	}
+	while (!__atomic_compare_exchange_n(&domain->records, &head, record, 1,
+										__ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+	return record;
+}
+
+/* hands the record back to its domain, or frees it if the domain is gone.
+   Only the record itself is read, as the domain may be freed meanwhile */
+static void ReleaseRecord(hazard_record_t *record)
+{
+	int owned = RECORD_OWNED;
+
+	HazardClear(record);
+	if (!__atomic_compare_exchange_n(&record->state, &owned, RECORD_FREE, 0,
+										__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+	{
+		FreeRecord(record);
+	}
+}
+
+/* the key's destructor, given the exiting thread's owned_records */
+static void ReleaseOwned(void *records)
+{
+	hazard_record_t **head = (hazard_record_t **)records;
+	hazard_record_t *record = *head;
+	hazard_record_t *next = NULL;
+
+	for (; NULL != record; record = next)
+	{
+		next = record->owned_next;
+		ReleaseRecord(record);
+	}
+
+	*head = NULL;
+}
+
+static void FreeRecord(hazard_record_t *record)
+{
+	free(record->retired);
+	free(record->slots);
+	free(record);
+}
+
+static void Scan(hazard_record_t *record)
+{
+	size_t i = 0;
+	size_t kept = 0;
+
+	for (i = 0; i < record->retired_count; ++i)
+	{
+		if (IsHazard(record->domain, record->retired[i]))
+		{
+			record->retired[kept] = record->retired[i];
+			++kept;
+		}
+		else
+		{
+			CacheBlock(record, record->retired[i]);
+		}
+	}
+
+	record->retired_count = kept;
+}
+
+static int IsHazard(const hazard_domain_t *domain, const void *block)
+{
+	hazard_record_t *record = __atomic_load_n(&domain->records,
+															__ATOMIC_ACQUIRE);
+	size_t i = 0;
+
+	for (; NULL != record; record = record->next)
+	{
+		for (i = 0; i < domain->slots_per_record; ++i)
+		{
+			if (block == __atomic_load_n(&record->slots[i], __ATOMIC_SEQ_CST))
+			{
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void CacheBlock(hazard_record_t *record, void *block)
+{
+	if (MAX_CACHED_BLOCKS == record->cached_count)
+	{
+		record->domain->free_func(block);
+		return;
+	}
+
+	*(void **)block = record->cached_blocks;
+	record->cached_blocks = block;
+	++record->cached_count;
+}
+
+static void FreeBlock(void *block)
+{
+	free(block);
+}
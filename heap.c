@@ -18,42 +18,93 @@ Approved date: 01/07/2024
 
 #define ADDRESS_SIZE sizeof(size_t)
 #define INIT_VECTOR_SIZE 5
+#define BINARY 2
+#define MAX_ARITY 16
 
 struct heap
 {
 	dvector_t *vector;
 	heap_compare_func_t cmp_func;
+	heap_compare_param_func_t cmp_param_func;
+	void *cmp_param;
+	heap_index_func_t index_func;
+	size_t arity;
 };
 
-static void HeapifyUp(heap_t *heap, size_t index);
+static heap_t *CreateHeap(heap_compare_func_t compare_func, 
+						heap_index_func_t index_func, size_t arity);
+static void Heapify(heap_t *heap);
+static size_t HeapifyUp(heap_t *heap, size_t index);
 static void HeapifyDown(heap_t *heap, size_t index);
-static void SwapElements(dvector_t *vector, size_t index1, size_t index2);
-static size_t GetParentIndex(size_t index);
-static size_t GetLeftChildIndex(size_t index);
-static size_t GetRightChildIndex(size_t index);
-static size_t FindIndexToSwap(heap_t *heap, size_t index);
+static int Compare(const heap_t *heap, const void *data1, const void *data2);
+static void **GetElements(heap_t *heap);
+static void NotifyIndex(heap_t *heap, void *data, size_t index);
+static size_t GetParentIndex(const heap_t *heap, size_t index);
+static size_t GetFirstChildIndex(const heap_t *heap, size_t index);
 static dvector_t *GetVector(heap_t *heap);
 
 heap_t *HeapCreate(heap_compare_func_t compare_func)
+{
+	assert(NULL != compare_func);
+
+	return CreateHeap(compare_func, NULL, BINARY);
+}
+
+/* index_func is called with every element whose position in the heap
+   changes, so the owner can keep a handle for HeapUpdate and HeapRemoveAt.
+   compare_func gets param with every call, so elements that are wrappers
+   can reach the owner's comparison without carrying it themselves */
+heap_t *HeapCreateIndexed(heap_compare_param_func_t compare_func, 
+								heap_index_func_t index_func, void *param)
 {
 	heap_t *heap = NULL;
 
 	assert(NULL != compare_func);
 
-	heap = (heap_t *)malloc(sizeof(heap_t));
+	heap = CreateHeap(NULL, index_func, BINARY);
 	if (NULL == heap)
 	{
 		return NULL;
 	}
 
-	heap->vector = DvectorCreate(INIT_VECTOR_SIZE, ADDRESS_SIZE);
-	if (NULL == heap->vector)
+	heap->cmp_param_func = compare_func;
+	heap->cmp_param = param;
+
+	return heap;
+}
+
+/* every node has arity children stored next to each other, so a pop scans
+   one contiguous run of pointers per level over a tree that is log2(arity)
+   times shorter. The runs are not aligned to cache lines. Push and
+   HeapUpdate upwards get cheaper too */
+heap_t *HeapCreateDary(heap_compare_func_t compare_func, size_t arity)
+{
+	assert(NULL != compare_func);
+	assert(2 <= arity && arity <= MAX_ARITY);
+
+	return CreateHeap(compare_func, NULL, arity);
+}
+
+/* builds the heap in O(count) instead of count pushes */
+heap_t *HeapCreateFromArray(heap_compare_func_t compare_func, 
+												void **array, size_t count)
+{
+	heap_t *heap = NULL;
+
+	assert(NULL != compare_func);
+	assert(NULL != array || 0 == count);
+
+	heap = HeapCreate(compare_func);
+	if (NULL == heap)
 	{
-		free(heap);
 		return NULL;
 	}
 
-	heap->cmp_func = compare_func;
+	if (0 != HeapPushMany(heap, array, count))
+	{
+		HeapDestroy(heap);
+		return NULL;
+	}
 
 	return heap;
 }
@@ -81,17 +132,47 @@ int HeapPush(heap_t *heap, void *data)
 	return 0;
 }
 
-void HeapPop(heap_t *heap)
+/* grows the vector once; when the batch is at least as large as the heap,
+   it is cheaper to append everything and heapify the whole array (O(n))
+   than to sift every new element up (O(count log n)). On failure the heap
+   is left unchanged */
+int HeapPushMany(heap_t *heap, void **array, size_t count)
 {
-	size_t last_index = HeapSize(heap) - 1;
+	size_t old_size = 0;
+	size_t i = 0;
 
 	assert(NULL != heap);
 	assert(NULL != heap->vector);
+	assert(NULL != array || 0 == count);
 
-	SwapElements(GetVector(heap), 0, last_index);
-	DvectorPopBack(GetVector(heap));
+	old_size = HeapSize(heap);
+	if (0 != DvectorPushBackMany(GetVector(heap), array, count))
+	{
+		return 1;
+	}
 
-	HeapifyDown(heap, 0);
+	if (count < old_size)
+	{
+		for (i = old_size; i < old_size + count; ++i)
+		{
+			HeapifyUp(heap, i);
+		}
+	}
+	else
+	{
+		Heapify(heap);
+	}
+
+	return 0;
+}
+
+void HeapPop(heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(NULL != heap->vector);
+	assert(0 < HeapSize(heap));
+
+	HeapRemoveAt(heap, 0);
 }
 
 void *HeapPeek(const heap_t *heap)
@@ -122,8 +203,6 @@ void *HeapRemove(heap_t *heap, heap_match_func_t is_match, void *data_to_match)
 {
 	size_t n = HeapSize(heap);
 	size_t i = 0;
-	size_t last_index = n - 1;
-	void *data = NULL;
 
 	assert(NULL != heap);
 	assert(NULL != heap->vector);
@@ -131,95 +210,222 @@ void *HeapRemove(heap_t *heap, heap_match_func_t is_match, void *data_to_match)
 
 	for (; i < n; ++i)
 	{
-		data = *(void **)DvectorGetElement(GetVector(heap), i);
-		if (1 == is_match(data, data_to_match))
+		if (1 == is_match(GetElements(heap)[i], data_to_match))
 		{
-			SwapElements(GetVector(heap), last_index, i);
-			DvectorPopBack(GetVector(heap));
-			HeapifyDown(heap, i);
-
-			return data;
+			return HeapRemoveAt(heap, i);
 		}
 	}
 
 	return NULL;
 }
 
-
-/**************************************** Helpers *****************************/
-static void HeapifyUp(heap_t *heap, size_t index)
+/* restores the heap after the priority of the element at index changed */
+void HeapUpdate(heap_t *heap, size_t index)
 {
-	size_t parent_index = GetParentIndex(index);
+	assert(NULL != heap);
+	assert(NULL != heap->vector);
+	assert(index < HeapSize(heap));
 
-	while (index > 0 && 
-			heap->cmp_func(*(void **)DvectorGetElement(GetVector(heap), index), 
-				*(void **)DvectorGetElement(GetVector(heap), parent_index)) > 0)
+	/* an element that moved up cannot also belong further down */
+	if (index == HeapifyUp(heap, index))
 	{
-		SwapElements(GetVector(heap), index, parent_index);
-		index = parent_index;
-		parent_index = GetParentIndex(index);
+		HeapifyDown(heap, index);
 	}
 }
 
-static void HeapifyDown(heap_t *heap, size_t index)
+/* the element at index in the heap's array order; index 0 is the top, and
+   walking 0 .. HeapSize - 1 visits every element once */
+void *HeapGetAt(const heap_t *heap, size_t index)
+{
+	assert(NULL != heap);
+	assert(NULL != heap->vector);
+	assert(index < HeapSize(heap));
+
+	return *(void **)DvectorGetElement(heap->vector, index);
+}
+
+void *HeapRemoveAt(heap_t *heap, size_t index)
 {
-	size_t index_to_swap = 0;
+	void **elements = NULL;
+	size_t last_index = 0;
+	void *data = NULL;
+
+	assert(NULL != heap);
+	assert(NULL != heap->vector);
+	assert(index < HeapSize(heap));
+
+	elements = GetElements(heap);
+	last_index = HeapSize(heap) - 1;
+	data = elements[index];
 
-	while (index < HeapSize(heap) && index != (index_to_swap = FindIndexToSwap(heap, index)))
+	/* the last element fills the hole, and may belong above or below it */
+	elements[index] = elements[last_index];
+	DvectorPopBack(GetVector(heap));
+
+	if (index < last_index)
 	{
-		SwapElements(GetVector(heap), index, index_to_swap);
-		index = index_to_swap;
+		HeapUpdate(heap, index);
 	}
+
+	return data;
 }
 
-static void SwapElements(dvector_t *vector, size_t index1, size_t index2)
+
+/**************************************** Helpers *****************************/
+static heap_t *CreateHeap(heap_compare_func_t compare_func, 
+						heap_index_func_t index_func, size_t arity)
 {
-	void **first_data = (void **)DvectorGetElement(vector, index1);
-	void **second_data = (void **)DvectorGetElement(vector, index2);
-	
-	void *temp = *first_data;
-	*first_data = *second_data;
-	*second_data = temp;
+	heap_t *heap = (heap_t *)malloc(sizeof(heap_t));
+	if (NULL == heap)
+	{
+		return NULL;
+	}
+
+	heap->vector = DvectorCreate(INIT_VECTOR_SIZE, ADDRESS_SIZE);
+	if (NULL == heap->vector)
+	{
+		free(heap);
+		return NULL;
+	}
+
+	heap->cmp_func = compare_func;
+	heap->cmp_param_func = NULL;
+	heap->cmp_param = NULL;
+	heap->index_func = index_func;
+	heap->arity = arity;
+
+	return heap;
 }
 
-static size_t GetParentIndex(size_t index)
+/* Floyd's bottom-up construction: sift down every parent, last one first */
+static void Heapify(heap_t *heap)
 {
-	return (index - 1) / 2;
+	void **elements = NULL;
+	size_t size = HeapSize(heap);
+	size_t i = 0;
+
+	if (0 == size)
+	{
+		return;
+	}
+
+	/* elements that never move must still learn their index */
+	elements = GetElements(heap);
+	for (i = 0; i < size; ++i)
+	{
+		NotifyIndex(heap, elements[i], i);
+	}
+
+	if (1 == size)
+	{
+		return;
+	}
+
+	for (i = GetParentIndex(heap, size - 1) + 1; 0 < i; --i)
+	{
+		HeapifyDown(heap, i - 1);
+	}
 }
 
-static size_t GetLeftChildIndex(size_t index)
+/* both sifts carry the moving element in a local and shift the others into
+   the hole it leaves, so each level costs one write instead of a swap. They
+   return the index where the element finally lands */
+static size_t HeapifyUp(heap_t *heap, size_t index)
 {
-	return 2 * index + 1;
+	void **elements = GetElements(heap);
+	void *data = elements[index];
+	size_t parent_index = 0;
+
+	while (index > 0)
+	{
+		parent_index = GetParentIndex(heap, index);
+		if (Compare(heap, data, elements[parent_index]) <= 0)
+		{
+			break;
+		}
+
+		elements[index] = elements[parent_index];
+		NotifyIndex(heap, elements[index], index);
+		index = parent_index;
+	}
+
+	elements[index] = data;
+	NotifyIndex(heap, data, index);
+
+	return index;
 }
 
-static size_t GetRightChildIndex(size_t index)
+static void HeapifyDown(heap_t *heap, size_t index)
 {
-	return 2 * index + 2;
+	void **elements = GetElements(heap);
+	void *data = elements[index];
+	size_t size = HeapSize(heap);
+	size_t child_index = 0;
+	size_t best_index = 0;
+	size_t end_index = 0;
+
+	while ((child_index = GetFirstChildIndex(heap, index)) < size)
+	{
+		end_index = child_index + heap->arity;
+		if (end_index > size)
+		{
+			end_index = size;
+		}
+
+		for (best_index = child_index++; child_index < end_index; ++child_index)
+		{
+			if (Compare(heap, elements[child_index], elements[best_index]) > 0)
+			{
+				best_index = child_index;
+			}
+		}
+
+		if (Compare(heap, elements[best_index], data) <= 0)
+		{
+			break;
+		}
+
+		elements[index] = elements[best_index];
+		NotifyIndex(heap, elements[index], index);
+		index = best_index;
+	}
+
+	elements[index] = data;
+	NotifyIndex(heap, data, index);
 }
 
-static size_t FindIndexToSwap(heap_t *heap, size_t index)
+static int Compare(const heap_t *heap, const void *data1, const void *data2)
 {
-	size_t left_child_index = GetLeftChildIndex(index);
-	size_t right_child_index = GetRightChildIndex(index);
-	size_t index_to_swap = index;
-	
-	if (left_child_index < HeapSize(heap) &&
-		heap->cmp_func(*(void **)DvectorGetElement(GetVector(heap), 
-															  left_child_index),
-					   *(void **)DvectorGetElement(GetVector(heap), index)) > 0)
+	if (NULL != heap->cmp_param_func)
 	{
-		index_to_swap = left_child_index;
+		return heap->cmp_param_func(data1, data2, heap->cmp_param);
 	}
 
-	if (right_child_index < HeapSize(heap) &&
-		heap->cmp_func(*(void **)DvectorGetElement(GetVector(heap), 
-															 right_child_index),
-			   *(void **)DvectorGetElement(GetVector(heap), index_to_swap)) > 0)
+	return heap->cmp_func(data1, data2);
+}
+
+/* the vector's buffer seen as an array; valid until the next push */
+static void **GetElements(heap_t *heap)
+{
+	return (void **)DvectorGetElement(GetVector(heap), 0);
+}
+
+static void NotifyIndex(heap_t *heap, void *data, size_t index)
+{
+	if (NULL != heap->index_func)
 	{
-		index_to_swap = right_child_index;
+		heap->index_func(data, index);
 	}
+}
 
-	return index_to_swap;
+static size_t GetParentIndex(const heap_t *heap, size_t index)
+{
+	return (index - 1) / heap->arity;
+}
+
+static size_t GetFirstChildIndex(const heap_t *heap, size_t index)
+{
+	return heap->arity * index + 1;
 }
 
 static dvector_t *GetVector(heap_t *heap)
@@ -8,18 +8,61 @@
    Approval Date: 
 */
 
+/* The heap holds the user's pointers directly until the first call to
+   Heap_PQEnqueueHandle. That call wraps every element in a handle that
+   knows its current index, so Heap_PQUpdate needs no search, and from then
+   on the queue keeps handles. Queues that never ask for one pay nothing. */
+
 #include <stdlib.h> /* size_t malloc() free() */
 #include <assert.h> /* assert() */
 
 #include "heap.h"
 #include "heap_pq.h"
 
+#define HANDLES_PER_SLAB 64
+
+/* a free handle keeps the next free one in data */
+struct heap_pq_handle
+{
+	void *data;
+	size_t index;
+};
+
+struct handle_slab
+{
+	struct handle_slab *next;
+	struct heap_pq_handle handles[HANDLES_PER_SLAB];
+};
 
 struct heap_pq 
 {
 	heap_t *heap;
+	heap_pq_compare_func_t cmp_func;
+	int has_handles;
+	struct handle_slab *slabs;
+	struct heap_pq_handle *free_handles;
+	size_t free_count;
 };
 
+struct handle_match
+{
+	heap_pq_match_func_t is_match;
+	const void *param;
+};
+
+static int PushHandle(heap_pq_t *queue, void *data,
+											struct heap_pq_handle **handle);
+static int SwitchToHandles(heap_pq_t *queue);
+static int CompareHandles(const void *handle1, const void *handle2,
+																void *queue);
+static void SetHandleIndex(void *handle, size_t index);
+static int MatchHandle(const void *handle, const void *match);
+static void *GetData(const heap_pq_t *queue, void *element);
+static int ReserveHandles(heap_pq_t *queue, size_t count);
+static struct heap_pq_handle *AllocHandle(heap_pq_t *queue);
+static void *ReleaseHandle(heap_pq_t *queue, struct heap_pq_handle *handle);
+static void ResetHandles(heap_pq_t *queue);
+
 
 heap_pq_t *Heap_PQCreate(heap_pq_compare_func_t cmp_func) 
 {
@@ -35,12 +78,18 @@ heap_pq_t *Heap_PQCreate(heap_pq_compare_func_t cmp_func)
 	}
 	
 	heap_pqueue->heap = HeapCreate(cmp_func);
-	if (heap_pqueue->heap == NULL) 
+	if (heap_pqueue->heap == NULL)
 	{
 		free(heap_pqueue);
 		return NULL;
 	}
 	
+	heap_pqueue->cmp_func = cmp_func;
+	heap_pqueue->has_handles = 0;
+	heap_pqueue->slabs = NULL;
+	heap_pqueue->free_handles = NULL;
+	heap_pqueue->free_count = 0;
+	
 	return heap_pqueue;
 }
 
@@ -48,35 +97,90 @@ heap_pq_t *Heap_PQCreate(heap_pq_compare_func_t cmp_func)
 
 void Heap_PQDestroy(heap_pq_t *queue) 
 {
+	struct handle_slab *slab = NULL;
+
 	assert(queue != NULL);
     assert(queue->heap != NULL);
     
 	HeapDestroy(queue->heap);
+
+	while (queue->slabs != NULL)
+	{
+		slab = queue->slabs;
+		queue->slabs = slab->next;
+		free(slab);
+	}
+
 	free(queue);
 }
 
 
 int Heap_PQEnqueue(heap_pq_t *queue, void *data) 
 {	
+	struct heap_pq_handle *handle = NULL;
+	
+	assert(queue != NULL);
+	assert(queue->heap != NULL);
+	
+	if (!queue->has_handles)
+	{
+		return HeapPush(queue->heap, data);
+	}
+
+	return PushHandle(queue, data, &handle);
+}
+
+
+
+/* *handle stays valid until its element is dequeued, erased or cleared.
+   The first call wraps every element already queued, in O(n) */
+int Heap_PQEnqueueHandle(heap_pq_t *queue, void *data, 
+												heap_pq_handle_t **handle) 
+{	
+	assert(queue != NULL);
+	assert(queue->heap != NULL);
+	assert(handle != NULL);
+	
+	if (!queue->has_handles && SwitchToHandles(queue) != 0)
+	{
+		return 1;
+	}
+	
+	return PushHandle(queue, data, handle);
+}
+
+
+
+/* the caller changes the priority inside the element, then calls this to
+   sift it to its new place - O(log n) instead of erase and re-enqueue */
+void Heap_PQUpdate(heap_pq_t *queue, heap_pq_handle_t *handle) 
+{
 	assert(queue != NULL);
 	assert(queue->heap != NULL);
+	assert(queue->has_handles);
+	assert(handle != NULL);
 	
-	return HeapPush(queue->heap, data); 
+	HeapUpdate(queue->heap, handle->index);
 }
 
 
 
 void *Heap_PQDequeue(heap_pq_t *queue) 
 {
-	void *data = NULL;
+	void *element = NULL;
 	
     assert(queue != NULL);
     assert(queue->heap != NULL);
     
-    data = HeapPeek(queue->heap);
+    element = HeapPeek(queue->heap);
     HeapPop(queue->heap);
     
-    return data;
+    if (!queue->has_handles)
+    {
+    	return element;
+    }
+
+    return ReleaseHandle(queue, (struct heap_pq_handle *)element);
 }
 
 
@@ -87,7 +191,7 @@ void *Heap_PQPeek(const heap_pq_t *queue)
     assert(queue != NULL);
     assert(queue->heap != NULL);
     
-    return HeapPeek(queue->heap);
+    return GetData(queue, HeapPeek(queue->heap));
 }
 
 
@@ -121,15 +225,218 @@ void Heap_PQClear(heap_pq_t *queue)
     {
 		HeapPop(queue->heap);
     }
+    
+    /* every handle was just dropped from the heap - recycle them at once */
+    if (queue->has_handles)
+    {
+    	ResetHandles(queue);
+    }
 }
 
 
 
 void *Heap_PQErase(heap_pq_t *queue, heap_pq_match_func_t is_match, void *param) 
 {
+	struct heap_pq_handle *handle = NULL;
+	struct handle_match match;
+	
 	assert(queue != NULL);
 	assert(is_match != NULL);
 	assert(queue->heap != NULL);
 
-	return HeapRemove(queue->heap, is_match, param);
+	if (!queue->has_handles)
+	{
+		return HeapRemove(queue->heap, is_match, param);
+	}
+	
+	match.is_match = is_match;
+	match.param = param;
+	
+	handle = (struct heap_pq_handle *)HeapRemove(queue->heap, MatchHandle, 
+																	&match);
+	if (handle == NULL) 
+	{
+		return NULL;
+	}
+	
+	return ReleaseHandle(queue, handle);
+}
+
+
+
+/**************************************** Helpers *****************************/
+static int PushHandle(heap_pq_t *queue, void *data,
+											struct heap_pq_handle **handle)
+{
+	struct heap_pq_handle *new_handle = AllocHandle(queue);
+	if (new_handle == NULL)
+	{
+		return 1;
+	}
+	
+	new_handle->data = data;
+
+	if (HeapPush(queue->heap, new_handle) != 0)
+	{
+		ReleaseHandle(queue, new_handle);
+		return 1;
+	}
+
+	*handle = new_handle;
+	return 0;
+}
+
+/* everything that can fail is allocated before the old heap is touched, so
+   on failure the queue is left as it was. The elements are wrapped in array
+   order, which is already a valid heap, so the bulk push only has to tell
+   every handle its index */
+static int SwitchToHandles(heap_pq_t *queue)
+{
+	heap_t *indexed = NULL;
+	struct heap_pq_handle *handle = NULL;
+	void **handles = NULL;
+	size_t size = HeapSize(queue->heap);
+	size_t i = 0;
+
+	indexed = HeapCreateIndexed(CompareHandles, SetHandleIndex, queue);
+	if (indexed == NULL)
+	{
+		return 1;
+	}
+
+	handles = (void **)malloc((0 == size ? 1 : size) * sizeof(void *));
+	if (handles == NULL || ReserveHandles(queue, size) != 0)
+	{
+		free(handles);
+		HeapDestroy(indexed);
+		return 1;
+	}
+
+	/* handles were reserved above, so AllocHandle cannot fail here */
+	for (i = 0; i < size; ++i)
+	{
+		handle = AllocHandle(queue);
+		handle->data = HeapGetAt(queue->heap, i);
+		handles[i] = handle;
+	}
+
+	if (HeapPushMany(indexed, handles, size) != 0)
+	{
+		for (i = 0; i < size; ++i)
+		{
+			ReleaseHandle(queue, (struct heap_pq_handle *)handles[i]);
+		}
+
+		free(handles);
+		HeapDestroy(indexed);
+		return 1;
+	}
+
+	free(handles);
+	HeapDestroy(queue->heap);
+	queue->heap = indexed;
+	queue->has_handles = 1;
+
+	return 0;
+}
+
+static int CompareHandles(const void *handle1, const void *handle2,
+																void *queue)
+{
+	return ((heap_pq_t *)queue)->cmp_func(
+								((const struct heap_pq_handle *)handle1)->data,
+								((const struct heap_pq_handle *)handle2)->data);
+}
+
+static void SetHandleIndex(void *handle, size_t index)
+{
+	((struct heap_pq_handle *)handle)->index = index;
+}
+
+static int MatchHandle(const void *handle, const void *match)
+{
+	const struct handle_match *closure = (const struct handle_match *)match;
+	
+	return closure->is_match(((const struct heap_pq_handle *)handle)->data, 
+															closure->param);
+}
+
+static void *GetData(const heap_pq_t *queue, void *element)
+{
+	if (!queue->has_handles)
+	{
+		return element;
+	}
+
+	return ((struct heap_pq_handle *)element)->data;
+}
+
+/* makes sure count handles can be taken without allocating */
+static int ReserveHandles(heap_pq_t *queue, size_t count)
+{
+	struct handle_slab *slab = NULL;
+	size_t i = 0;
+
+	while (queue->free_count < count)
+	{
+		slab = (struct handle_slab *)malloc(sizeof(struct handle_slab));
+		if (slab == NULL)
+		{
+			return 1;
+		}
+
+		slab->next = queue->slabs;
+		queue->slabs = slab;
+
+		for (i = 0; i < HANDLES_PER_SLAB; ++i)
+		{
+			ReleaseHandle(queue, &slab->handles[i]);
+		}
+	}
+
+	return 0;
+}
+
+static struct heap_pq_handle *AllocHandle(heap_pq_t *queue)
+{
+	struct heap_pq_handle *handle = NULL;
+
+	if (ReserveHandles(queue, 1) != 0)
+	{
+		return NULL;
+	}
+
+	handle = queue->free_handles;
+	queue->free_handles = (struct heap_pq_handle *)handle->data;
+	--queue->free_count;
+
+	return handle;
+}
+
+static void *ReleaseHandle(heap_pq_t *queue, struct heap_pq_handle *handle)
+{
+	void *data = handle->data;
+	
+	handle->data = queue->free_handles;
+	queue->free_handles = handle;
+	++queue->free_count;
+
+	return data;
+}
+
+static void ResetHandles(heap_pq_t *queue)
+{
+	struct handle_slab *slab = NULL;
+	size_t i = 0;
+
+	queue->free_handles = NULL;
+	queue->free_count = 0;
+
+	for (slab = queue->slabs; slab != NULL; slab = slab->next)
+	{
+		for (i = 0; i < HANDLES_PER_SLAB; ++i)
+		{
+			ReleaseHandle(queue, &slab->handles[i]);
+		}
+	}
 }
@@ -0,0 +1,437 @@
+/*
+   Code by: Or Yamin
+   Project: Index-based list stored in a contiguous arena
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* All nodes live in one growable array and link to each other through
+   32-bit indices, so a node is 16 bytes and the array can be realloc'd
+   without invalidating iterators. Slot 0 is the sentinel: it is both the
+   end iterator and the "none" value of the free-slot chain. */
+
+#include <stdlib.h> /* size_t malloc() realloc() free() */
+#include <assert.h> /* assert() */
+#include <stdint.h> /* uint32_t UINT32_MAX */
+
+#include "idxlist.h"
+
+#define SENTINEL 0
+#define GROWTH_FACTOR 2
+#define MIN_CAPACITY 8
+
+struct idxlist_node
+{
+	void *data;
+	uint32_t next;
+	uint32_t prev;
+};
+
+struct idxlist
+{
+	struct idxlist_node *nodes;
+	size_t capacity;
+	size_t used;
+	size_t size;
+	uint32_t free_head;
+};
+
+static uint32_t AllocSlot(idxlist_t *list);
+static void FreeSlot(idxlist_t *list, uint32_t slot);
+static void Unlink(idxlist_t *list, uint32_t slot);
+static void LinkBefore(idxlist_t *list, uint32_t where, uint32_t slot);
+
+
+/* returns NULL for a capacity the 32-bit links cannot index, as growth
+   stops at UINT32_MAX slots */
+idxlist_t *IdxlistCreate(size_t capacity)
+{
+	idxlist_t *list = NULL;
+
+	if (capacity >= UINT32_MAX)
+	{
+		return NULL;
+	}
+
+	list = (idxlist_t *)malloc(sizeof(idxlist_t));
+	if (NULL == list)
+	{
+		return NULL;
+	}
+
+	/* one extra slot for the sentinel */
+	list->capacity = (capacity < MIN_CAPACITY) ? MIN_CAPACITY : capacity + 1;
+	list->nodes = (struct idxlist_node *)malloc(list->capacity *
+												sizeof(struct idxlist_node));
+	if (NULL == list->nodes)
+	{
+		free(list);
+		return NULL;
+	}
+
+	list->nodes[SENTINEL].data = NULL;
+	list->nodes[SENTINEL].next = SENTINEL;
+	list->nodes[SENTINEL].prev = SENTINEL;
+	list->used = 1;
+	list->size = 0;
+	list->free_head = SENTINEL;
+
+	return list;
+}
+
+
+
+void IdxlistDestroy(idxlist_t *list)
+{
+	assert(NULL != list);
+
+	free(list->nodes);
+	free(list);
+}
+
+
+
+idxlist_iter_t IdxlistNext(const idxlist_t *list, idxlist_iter_t iter)
+{
+	assert(NULL != list);
+	assert(SENTINEL != iter);
+
+	return list->nodes[iter].next;
+}
+
+
+
+idxlist_iter_t IdxlistPrev(const idxlist_t *list, idxlist_iter_t iter)
+{
+	assert(NULL != list);
+	assert(SENTINEL != list->nodes[iter].prev);
+
+	return list->nodes[iter].prev;
+}
+
+
+
+idxlist_iter_t IdxlistGetBegin(const idxlist_t *list)
+{
+	assert(NULL != list);
+	return list->nodes[SENTINEL].next;
+}
+
+
+
+idxlist_iter_t IdxlistGetEnd(const idxlist_t *list)
+{
+	assert(NULL != list);
+	(void)list;
+	return SENTINEL;
+}
+
+
+
+idxlist_iter_t IdxlistInsertBefore(idxlist_t *list, void *data,
+														idxlist_iter_t where)
+{
+	uint32_t slot = SENTINEL;
+
+	assert(NULL != list);
+	assert(where < list->used);
+
+	slot = AllocSlot(list);
+	if (SENTINEL == slot)
+	{
+		return SENTINEL;
+	}
+
+	list->nodes[slot].data = data;
+	LinkBefore(list, where, slot);
+	++list->size;
+
+	return slot;
+}
+
+
+
+idxlist_iter_t IdxlistRemove(idxlist_t *list, idxlist_iter_t where)
+{
+	uint32_t next = SENTINEL;
+
+	assert(NULL != list);
+	assert(SENTINEL != where);
+
+	next = list->nodes[where].next;
+	Unlink(list, where);
+	FreeSlot(list, where);
+	--list->size;
+
+	return next;
+}
+
+
+
+/* same contract as DllistSplice, for ranges of the same list */
+idxlist_iter_t IdxlistSplice(idxlist_t *list, idxlist_iter_t where,
+									idxlist_iter_t from, idxlist_iter_t to)
+{
+	struct idxlist_node *nodes = NULL;
+	uint32_t last = SENTINEL;
+
+	assert(NULL != list);
+
+	nodes = list->nodes;
+	if (from == to)
+	{
+		return nodes[where].prev;
+	}
+
+	last = nodes[to].prev;
+
+	nodes[nodes[from].prev].next = to;
+	nodes[to].prev = nodes[from].prev;
+
+	nodes[nodes[where].prev].next = from;
+	nodes[from].prev = nodes[where].prev;
+	nodes[last].next = where;
+	nodes[where].prev = last;
+
+	return last;
+}
+
+
+
+size_t IdxlistSize(const idxlist_t *list)
+{
+	assert(NULL != list);
+	return list->size;
+}
+
+
+
+void *IdxlistGetData(const idxlist_t *list, idxlist_iter_t iter)
+{
+	assert(NULL != list);
+	assert(SENTINEL != iter);
+
+	return list->nodes[iter].data;
+}
+
+
+
+idxlist_iter_t IdxlistSetData(idxlist_t *list, idxlist_iter_t iter,
+																void *new_data)
+{
+	assert(NULL != list);
+	assert(SENTINEL != iter);
+
+	list->nodes[iter].data = new_data;
+	return iter;
+}
+
+
+
+int IdxlistIsEmpty(const idxlist_t *list)
+{
+	assert(NULL != list);
+	return (0 == list->size);
+}
+
+
+
+idxlist_iter_t IdxlistFind(const idxlist_t *list, void *param,
+				idxlist_iter_t from, idxlist_iter_t to, match_func_t is_match)
+{
+	const struct idxlist_node *nodes = NULL;
+
+	assert(NULL != list);
+	assert(NULL != is_match);
+
+	nodes = list->nodes;
+	while (from != to && !is_match(nodes[from].data, param))
+	{
+		from = nodes[from].next;
+	}
+
+	return from;
+}
+
+
+
+int IdxlistForEach(const idxlist_t *list, idxlist_iter_t from,
+					idxlist_iter_t to, action_func_t action, void *param)
+{
+	const struct idxlist_node *nodes = NULL;
+	int status = 0;
+
+	assert(NULL != list);
+	assert(NULL != action);
+
+	nodes = list->nodes;
+	for (; from != to; from = nodes[from].next)
+	{
+		status = action(nodes[from].data, param);
+	}
+
+	return status;
+}
+
+
+
+idxlist_iter_t IdxlistPushFront(idxlist_t *list, void *data)
+{
+	assert(NULL != list);
+	return IdxlistInsertBefore(list, data, IdxlistGetBegin(list));
+}
+
+
+
+idxlist_iter_t IdxlistPushBack(idxlist_t *list, void *data)
+{
+	assert(NULL != list);
+	return IdxlistInsertBefore(list, data, SENTINEL);
+}
+
+
+
+void *IdxlistPopFront(idxlist_t *list)
+{
+	uint32_t first = SENTINEL;
+	void *data = NULL;
+
+	assert(NULL != list);
+	assert(0 < list->size);
+
+	first = list->nodes[SENTINEL].next;
+	data = list->nodes[first].data;
+	IdxlistRemove(list, first);
+
+	return data;
+}
+
+
+
+void *IdxlistPopBack(idxlist_t *list)
+{
+	uint32_t last = SENTINEL;
+	void *data = NULL;
+
+	assert(NULL != list);
+	assert(0 < list->size);
+
+	last = list->nodes[SENTINEL].prev;
+	data = list->nodes[last].data;
+	IdxlistRemove(list, last);
+
+	return data;
+}
+
+
+
+/* rewrites the arena so list order equals array order; every iterator held
+   before the call is invalidated */
+int IdxlistCompact(idxlist_t *list)
+{
+	struct idxlist_node *new_nodes = NULL;
+	uint32_t runner = SENTINEL;
+	uint32_t i = 0;
+
+	assert(NULL != list);
+
+	new_nodes = (struct idxlist_node *)malloc(list->capacity *
+												sizeof(struct idxlist_node));
+	if (NULL == new_nodes)
+	{
+		return 1;
+	}
+
+	new_nodes[SENTINEL].data = NULL;
+	runner = list->nodes[SENTINEL].next;
+	for (i = 1; SENTINEL != runner; ++i)
+	{
+		new_nodes[i].data = list->nodes[runner].data;
+		new_nodes[i].prev = i - 1;
+		new_nodes[i].next = i + 1;
+		runner = list->nodes[runner].next;
+	}
+
+	/* i is one past the last element here */
+	new_nodes[i - 1].next = SENTINEL;
+	new_nodes[SENTINEL].prev = i - 1;
+	new_nodes[SENTINEL].next = (1 == i) ? SENTINEL : 1;
+
+	free(list->nodes);
+	list->nodes = new_nodes;
+	list->used = i;
+	list->free_head = SENTINEL;
+
+	return 0;
+}
+
+
+/**************************************** Helpers *****************************/
+static uint32_t AllocSlot(idxlist_t *list)
+{
+	struct idxlist_node *new_nodes = NULL;
+	size_t new_capacity = 0;
+	uint32_t slot = list->free_head;
+
+	if (SENTINEL != slot)
+	{
+		list->free_head = list->nodes[slot].next;
+		return slot;
+	}
+
+	if (list->used == list->capacity)
+	{
+		new_capacity = list->capacity * GROWTH_FACTOR;
+		if (new_capacity > UINT32_MAX)
+		{
+			new_capacity = UINT32_MAX;
+		}
+
+		if (new_capacity == list->capacity)
+		{
+			return SENTINEL;
+		}
+
+		new_nodes = (struct idxlist_node *)realloc(list->nodes,
+								new_capacity * sizeof(struct idxlist_node));
+		if (NULL == new_nodes)
+		{
+			return SENTINEL;
+		}
+
+		list->nodes = new_nodes;
+		list->capacity = new_capacity;
+	}
+
+	slot = (uint32_t)list->used;
+	++list->used;
+
+	return slot;
+}
+
+static void FreeSlot(idxlist_t *list, uint32_t slot)
+{
+	list->nodes[slot].next = list->free_head;
+	list->free_head = slot;
+}
+
+static void Unlink(idxlist_t *list, uint32_t slot)
+{
+	struct idxlist_node *nodes = list->nodes;
+
+	nodes[nodes[slot].prev].next = nodes[slot].next;
+	nodes[nodes[slot].next].prev = nodes[slot].prev;
+}
+
+static void LinkBefore(idxlist_t *list, uint32_t where, uint32_t slot)
+{
+	struct idxlist_node *nodes = list->nodes;
+
+	nodes[slot].next = where;
+	nodes[slot].prev = nodes[where].prev;
+	nodes[nodes[where].prev].next = slot;
+	nodes[where].prev = slot;
+}
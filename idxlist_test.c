@@ -0,0 +1,246 @@
+/*
+   Code by: Or Yamin
+   Project: Index-based list stored in a contiguous arena - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stdint.h> /* UINT32_MAX */
+
+#include "idxlist.h"
+
+#define VALUES 100
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+static int failures = 0;
+static int values[VALUES];
+
+static void TestEnds(void);
+static void TestIteratorsSurviveGrowth(void);
+static void TestRemoveReusesSlots(void);
+static void TestSpliceCompact(void);
+static void TestFindForEach(void);
+static void TestCapacityLimit(void);
+static int Matches(const idxlist_t *list, const int *expected, size_t count);
+static int IsValue(const void *data, const void *param);
+static int Sum(void *data, void *param);
+
+
+int main(void)
+{
+	size_t i = 0;
+
+	for (i = 0; i < VALUES; ++i)
+	{
+		values[i] = (int)i;
+	}
+
+	TestEnds();
+	TestIteratorsSurviveGrowth();
+	TestRemoveReusesSlots();
+	TestSpliceCompact();
+	TestFindForEach();
+	TestCapacityLimit();
+
+	if (0 == failures)
+	{
+		puts("idxlist: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestEnds(void)
+{
+	idxlist_t *list = IdxlistCreate(4);
+	int expected[] = {2, 1, 0, 3, 4, 5};
+	size_t i = 0;
+
+	CHECK(NULL != list);
+	CHECK(IdxlistIsEmpty(list));
+	CHECK(IdxlistGetBegin(list) == IdxlistGetEnd(list));
+
+	for (i = 0; i < 3; ++i)
+	{
+		IdxlistPushFront(list, &values[i]);
+		IdxlistPushBack(list, &values[i + 3]);
+	}
+	CHECK(Matches(list, expected, 6));
+
+	CHECK(&values[2] == IdxlistPopFront(list));
+	CHECK(&values[5] == IdxlistPopBack(list));
+	CHECK(4 == IdxlistSize(list));
+
+	IdxlistDestroy(list);
+}
+
+/* iterators are indices, so they stay valid when the arena is realloc'd */
+static void TestIteratorsSurviveGrowth(void)
+{
+	idxlist_t *list = IdxlistCreate(1);
+	idxlist_iter_t iters[VALUES];
+	size_t i = 0;
+
+	for (i = 0; i < VALUES; ++i)
+	{
+		iters[i] = IdxlistPushBack(list, &values[i]);
+		CHECK(IdxlistGetEnd(list) != iters[i]);
+	}
+
+	for (i = 0; i < VALUES; ++i)
+	{
+		CHECK(&values[i] == IdxlistGetData(list, iters[i]));
+	}
+
+	IdxlistSetData(list, iters[10], &values[0]);
+	CHECK(&values[0] == IdxlistGetData(list, iters[10]));
+
+	IdxlistDestroy(list);
+}
+
+static void TestRemoveReusesSlots(void)
+{
+	idxlist_t *list = IdxlistCreate(8);
+	idxlist_iter_t iters[5];
+	idxlist_iter_t next = 0;
+	idxlist_iter_t reused = 0;
+	int expected[] = {0, 2, 4, 9};
+	size_t i = 0;
+
+	for (i = 0; i < 5; ++i)
+	{
+		iters[i] = IdxlistPushBack(list, &values[i]);
+	}
+
+	next = IdxlistRemove(list, iters[1]);
+	CHECK(iters[2] == next);
+	CHECK(IdxlistGetEnd(list) == IdxlistRemove(list, iters[4]));
+	IdxlistRemove(list, iters[3]);
+
+	/* the most recently freed slot is taken first */
+	reused = IdxlistPushBack(list, &values[4]);
+	CHECK(iters[3] == reused);
+	reused = IdxlistPushBack(list, &values[9]);
+	CHECK(iters[4] == reused);
+	CHECK(Matches(list, expected, 4));
+
+	IdxlistDestroy(list);
+}
+
+static void TestSpliceCompact(void)
+{
+	idxlist_t *list = IdxlistCreate(8);
+	idxlist_iter_t iters[6];
+	int spliced[] = {3, 4, 0, 1, 2, 5};
+	size_t i = 0;
+
+	for (i = 0; i < 6; ++i)
+	{
+		iters[i] = IdxlistPushBack(list, &values[i]);
+	}
+
+	/* moves [3, 5) in front of 0 */
+	CHECK(iters[4] == IdxlistSplice(list, iters[0], iters[3], iters[5]));
+	CHECK(Matches(list, spliced, 6));
+
+	/* compaction keeps the order and puts it in array order as well */
+	CHECK(0 == IdxlistCompact(list));
+	CHECK(Matches(list, spliced, 6));
+	CHECK(&values[3] == IdxlistGetData(list, IdxlistGetBegin(list)));
+
+	IdxlistDestroy(list);
+}
+
+static void TestFindForEach(void)
+{
+	idxlist_t *list = IdxlistCreate(16);
+	idxlist_iter_t found = 0;
+	int target = 7;
+	int sum = 0;
+	size_t i = 0;
+
+	for (i = 0; i < 10; ++i)
+	{
+		IdxlistPushBack(list, &values[i]);
+	}
+
+	found = IdxlistFind(list, &target, IdxlistGetBegin(list),
+											IdxlistGetEnd(list), IsValue);
+	CHECK(&values[7] == IdxlistGetData(list, found));
+
+	target = -1;
+	found = IdxlistFind(list, &target, IdxlistGetBegin(list),
+											IdxlistGetEnd(list), IsValue);
+	CHECK(IdxlistGetEnd(list) == found);
+
+	CHECK(0 == IdxlistForEach(list, IdxlistGetBegin(list),
+										IdxlistGetEnd(list), Sum, &sum));
+	CHECK(45 == sum);
+
+	IdxlistDestroy(list);
+}
+
+/* the links are 32 bits wide */
+static void TestCapacityLimit(void)
+{
+	CHECK(NULL == IdxlistCreate((size_t)UINT32_MAX));
+	CHECK(NULL == IdxlistCreate((size_t)-1));
+}
+
+/* walks forwards and then backwards */
+static int Matches(const idxlist_t *list, const int *expected, size_t count)
+{
+	idxlist_iter_t iter = 0;
+	size_t i = 0;
+
+	if (count != IdxlistSize(list))
+	{
+		return 0;
+	}
+
+	for (iter = IdxlistGetBegin(list); IdxlistGetEnd(list) != iter;
+											iter = IdxlistNext(list, iter))
+	{
+		if (i == count || expected[i++] != *(int *)IdxlistGetData(list, iter))
+		{
+			return 0;
+		}
+	}
+
+	for (iter = IdxlistGetEnd(list); 0 < i; --i)
+	{
+		iter = IdxlistPrev(list, iter);
+		if (expected[i - 1] != *(int *)IdxlistGetData(list, iter))
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+static int IsValue(const void *data, const void *param)
+{
+	return (*(const int *)data == *(const int *)param);
+}
+
+static int Sum(void *data, void *param)
+{
+	*(int *)param += *(int *)data;
+	return 0;
+}
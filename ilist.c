@@ -0,0 +1,257 @@
+/*
+   Code by: Or Yamin
+   Project: Intrusive doubly linked list
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* Users embed an ilist_node_t in their own struct and the list only relinks
+   those embedded nodes - nothing here calls malloc. The list keeps a single
+   sentinel node inside ilist_t, which doubles as the end iterator. */
+
+#include <stddef.h> /* size_t */
+#include <assert.h> /* assert */
+
+#include "ilist.h"
+
+
+static void Link(ilist_node_t *where, ilist_node_t *node);
+
+
+void IlistInit(ilist_t *list)
+{
+	assert(NULL != list);
+
+	list->head.next = &list->head;
+	list->head.prev = &list->head;
+}
+
+
+
+ilist_node_t *IlistBegin(const ilist_t *list)
+{
+	assert(NULL != list);
+	return list->head.next;
+}
+
+
+
+ilist_node_t *IlistEnd(const ilist_t *list)
+{
+	assert(NULL != list);
+	return (ilist_node_t *)&list->head;
+}
+
+
+
+ilist_node_t *IlistNext(const ilist_node_t *node)
+{
+	assert(NULL != node);
+	return node->next;
+}
+
+
+
+ilist_node_t *IlistPrev(const ilist_node_t *node)
+{
+	assert(NULL != node);
+	return node->prev;
+}
+
+
+
+ilist_node_t *IlistInsertBefore(ilist_node_t *where, ilist_node_t *node)
+{
+	assert(NULL != where);
+	assert(NULL != node);
+
+	Link(where, node);
+	return node;
+}
+
+
+
+ilist_node_t *IlistPushFront(ilist_t *list, ilist_node_t *node)
+{
+	assert(NULL != list);
+	return IlistInsertBefore(list->head.next, node);
+}
+
+
+
+ilist_node_t *IlistPushBack(ilist_t *list, ilist_node_t *node)
+{
+	assert(NULL != list);
+	return IlistInsertBefore(&list->head, node);
+}
+
+
+
+ilist_node_t *IlistRemove(ilist_node_t *node)
+{
+	ilist_node_t *next = NULL;
+
+	assert(NULL != node);
+	assert(node->next != node);
+
+	next = node->next;
+	node->prev->next = next;
+	next->prev = node->prev;
+
+	node->next = NULL;
+	node->prev = NULL;
+
+	return next;
+}
+
+
+
+ilist_node_t *IlistPopFront(ilist_t *list)
+{
+	ilist_node_t *node = NULL;
+
+	assert(NULL != list);
+
+	if (IlistIsEmpty(list))
+	{
+		return NULL;
+	}
+
+	node = list->head.next;
+	IlistRemove(node);
+	return node;
+}
+
+
+
+ilist_node_t *IlistPopBack(ilist_t *list)
+{
+	ilist_node_t *node = NULL;
+
+	assert(NULL != list);
+
+	if (IlistIsEmpty(list))
+	{
+		return NULL;
+	}
+
+	node = list->head.prev;
+	IlistRemove(node);
+	return node;
+}
+
+
+
+int IlistIsEmpty(const ilist_t *list)
+{
+	assert(NULL != list);
+	return (list->head.next == &list->head);
+}
+
+
+
+size_t IlistSize(const ilist_t *list)
+{
+	const ilist_node_t *runner = NULL;
+	size_t count = 0;
+
+	assert(NULL != list);
+
+	for (runner = list->head.next; runner != &list->head; runner = runner->next)
+	{
+		++count;
+	}
+
+	return count;
+}
+
+
+
+/* same contract as DllistSplice: moves [from, to) before where and returns
+   the last node moved */
+ilist_node_t *IlistSplice(ilist_node_t *where, ilist_node_t *from,
+															ilist_node_t *to)
+{
+	ilist_node_t *last = NULL;
+
+	assert(NULL != where);
+	assert(NULL != from);
+	assert(NULL != to);
+
+	if (from == to)
+	{
+		return where->prev;
+	}
+
+	last = to->prev;
+
+	from->prev->next = to;
+	to->prev = from->prev;
+
+	where->prev->next = from;
+	from->prev = where->prev;
+	last->next = where;
+	where->prev = last;
+
+	return last;
+}
+
+
+
+int IlistForEach(ilist_node_t *from, ilist_node_t *to,
+									ilist_action_func_t action, void *param)
+{
+	ilist_node_t *next = NULL;
+	int status = 0;
+
+	assert(NULL != from);
+	assert(NULL != to);
+	assert(NULL != action);
+
+	/* next is read first, so action may unlink the node it is given */
+	for (; from != to && 0 == status; from = next)
+	{
+		next = from->next;
+		status = action(from, param);
+	}
+
+	return status;
+}
+
+
+
+ilist_node_t *IlistFind(ilist_node_t *from, ilist_node_t *to,
+								ilist_match_func_t is_match, const void *param)
+{
+	assert(NULL != from);
+	assert(NULL != to);
+	assert(NULL != is_match);
+
+	while (from != to && !is_match(from, param))
+	{
+		from = from->next;
+	}
+
+	return from;
+}
+
+
+
+void *IlistEntry(const ilist_node_t *node, size_t member_offset)
+{
+	assert(NULL != node);
+	return (char *)node - member_offset;
+}
+
+
+/**************************************** Helpers *****************************/
+static void Link(ilist_node_t *where, ilist_node_t *node)
+{
+	node->next = where;
+	node->prev = where->prev;
+	where->prev->next = node;
+	where->prev = node;
+}
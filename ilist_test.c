@@ -0,0 +1,239 @@
+/*
+   Code by: Or Yamin
+   Project: Intrusive doubly linked list - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stddef.h> /* offsetof() */
+
+#include "ilist.h"
+
+#define ITEMS 6
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+/* the node is deliberately not the first member, so IlistEntry must
+   subtract the offset */
+struct item
+{
+	int value;
+	ilist_node_t node;
+};
+
+static int failures = 0;
+
+static void TestPushPop(void);
+static void TestRemoveInsert(void);
+static void TestSplice(void);
+static void TestForEachFind(void);
+static void FillItems(struct item *items, ilist_t *list);
+static int ValueAt(ilist_node_t *node);
+static int CheckOrder(const ilist_t *list, const int *expected, size_t count);
+static int RemoveOdd(ilist_node_t *node, void *param);
+static int IsValue(const ilist_node_t *node, const void *param);
+
+
+int main(void)
+{
+	TestPushPop();
+	TestRemoveInsert();
+	TestSplice();
+	TestForEachFind();
+
+	if (0 == failures)
+	{
+		puts("ilist: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestPushPop(void)
+{
+	struct item items[ITEMS];
+	ilist_t list;
+	int expected[] = {2, 1, 0, 3, 4, 5};
+
+	IlistInit(&list);
+	CHECK(IlistIsEmpty(&list));
+	CHECK(0 == IlistSize(&list));
+	CHECK(IlistBegin(&list) == IlistEnd(&list));
+	CHECK(NULL == IlistPopFront(&list));
+	CHECK(NULL == IlistPopBack(&list));
+
+	FillItems(items, NULL);
+	IlistPushFront(&list, &items[0].node);
+	IlistPushFront(&list, &items[1].node);
+	IlistPushFront(&list, &items[2].node);
+	IlistPushBack(&list, &items[3].node);
+	IlistPushBack(&list, &items[4].node);
+	IlistPushBack(&list, &items[5].node);
+
+	CHECK(ITEMS == IlistSize(&list));
+	CHECK(CheckOrder(&list, expected, ITEMS));
+
+	CHECK(&items[2].node == IlistPopFront(&list));
+	CHECK(&items[5].node == IlistPopBack(&list));
+	CHECK(4 == IlistSize(&list));
+	CHECK(1 == ValueAt(IlistBegin(&list)));
+	CHECK(4 == ValueAt(IlistPrev(IlistEnd(&list))));
+}
+
+static void TestRemoveInsert(void)
+{
+	struct item items[ITEMS];
+	ilist_t list;
+	ilist_node_t *next = NULL;
+	int after_remove[] = {0, 1, 3, 4, 5};
+	int after_insert[] = {2, 0, 1, 3, 4, 5};
+
+	IlistInit(&list);
+	FillItems(items, &list);
+
+	next = IlistRemove(&items[2].node);
+	CHECK(&items[3].node == next);
+	CHECK(CheckOrder(&list, after_remove, ITEMS - 1));
+
+	/* a removed node can be linked again, here in front of the list */
+	IlistInsertBefore(IlistBegin(&list), &items[2].node);
+	CHECK(CheckOrder(&list, after_insert, ITEMS));
+}
+
+static void TestSplice(void)
+{
+	struct item items[ITEMS];
+	struct item others[ITEMS];
+	ilist_t list;
+	ilist_t other;
+	int expected[] = {0, 13, 14, 1, 2, 3, 4, 5};
+	int rest[] = {10, 11, 12, 15};
+	size_t i = 0;
+
+	IlistInit(&list);
+	IlistInit(&other);
+	FillItems(items, &list);
+	FillItems(others, &other);
+	for (i = 0; i < ITEMS; ++i)
+	{
+		others[i].value += 10;
+	}
+
+	/* moves [13, 15) before 1 */
+	CHECK(&others[4].node == IlistSplice(&items[1].node, &others[3].node,
+														&others[5].node));
+	CHECK(CheckOrder(&list, expected, ITEMS + 2));
+
+	/* moves 10 11 12 to the end of the same list they are in */
+	IlistSplice(IlistEnd(&other), IlistBegin(&other), &others[5].node);
+	CHECK(15 == ValueAt(IlistBegin(&other)));
+	IlistSplice(IlistEnd(&other), IlistBegin(&other), &others[0].node);
+	CHECK(CheckOrder(&other, rest, 4));
+
+	/* an empty range changes nothing */
+	IlistSplice(&items[0].node, &others[0].node, &others[0].node);
+	CHECK(CheckOrder(&list, expected, ITEMS + 2));
+}
+
+static void TestForEachFind(void)
+{
+	struct item items[ITEMS];
+	ilist_t list;
+	int even[] = {0, 2, 4};
+	int value = 4;
+
+	IlistInit(&list);
+	FillItems(items, &list);
+
+	/* the action may unlink the node it is given */
+	CHECK(0 == IlistForEach(IlistBegin(&list), IlistEnd(&list), RemoveOdd,
+																		NULL));
+	CHECK(CheckOrder(&list, even, 3));
+
+	CHECK(&items[4].node == IlistFind(IlistBegin(&list), IlistEnd(&list),
+															IsValue, &value));
+	value = 1;
+	CHECK(IlistEnd(&list) == IlistFind(IlistBegin(&list), IlistEnd(&list),
+															IsValue, &value));
+}
+
+/* values 0 .. ITEMS - 1, pushed in order when list is not NULL */
+static void FillItems(struct item *items, ilist_t *list)
+{
+	size_t i = 0;
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		items[i].value = (int)i;
+		if (NULL != list)
+		{
+			IlistPushBack(list, &items[i].node);
+		}
+	}
+}
+
+static int ValueAt(ilist_node_t *node)
+{
+	return ((struct item *)IlistEntry(node, offsetof(struct item, node)))->value;
+}
+
+static int CheckOrder(const ilist_t *list, const int *expected, size_t count)
+{
+	ilist_node_t *node = NULL;
+	size_t i = 0;
+
+	if (count != IlistSize(list))
+	{
+		return 0;
+	}
+
+	/* forwards, then backwards, so both link directions are checked */
+	for (node = IlistBegin(list); node != IlistEnd(list); node = IlistNext(node))
+	{
+		if (expected[i++] != ValueAt(node))
+		{
+			return 0;
+		}
+	}
+	for (node = IlistPrev(IlistEnd(list)); node != IlistEnd(list);
+													node = IlistPrev(node))
+	{
+		if (expected[--i] != ValueAt(node))
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+static int RemoveOdd(ilist_node_t *node, void *param)
+{
+	(void)param;
+
+	if (ValueAt(node) & 1)
+	{
+		IlistRemove(node);
+	}
+
+	return 0;
+}
+
+static int IsValue(const ilist_node_t *node, const void *param)
+{
+	return (*(const int *)param == ValueAt((ilist_node_t *)node));
+}
@@ -0,0 +1,276 @@
+/*
+   Code by: Or Yamin
+   Project: Lock-free queue (Michael-Scott)
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdlib.h> /* malloc posix_memalign free size_t */
+#include <assert.h> /* assert */
+
+#include "hazard.h"
+#include "lfq.h"
+
+#define CACHE_LINE 64
+#define HAZARDS_PER_THREAD 2
+#define HP_HEAD 0
+#define HP_NEXT 1
+
+struct lfq_node
+{
+	void *data;
+	struct lfq_node *next;
+};
+
+/* head, tail and size each live on their own cache line so producers and
+   consumers do not invalidate each other; the struct is allocated on a line
+   boundary for the padding to hold */
+struct lfq
+{
+	struct lfq_node *head;
+	char head_pad[CACHE_LINE - sizeof(struct lfq_node *)];
+	struct lfq_node *tail;
+	char tail_pad[CACHE_LINE - sizeof(struct lfq_node *)];
+	size_t size;
+	char size_pad[CACHE_LINE - sizeof(size_t)];
+	hazard_domain_t *hazards;
+};
+
+static struct lfq_node *CreateNode(hazard_record_t *record, void *data);
+
+
+lfq_t *LFQCreate(void)
+{
+	lfq_t *queue = NULL;
+	void *memory = NULL;
+	struct lfq_node *dummy = NULL;
+
+	if (0 != posix_memalign(&memory, CACHE_LINE, sizeof(lfq_t)))
+	{
+		return NULL;
+	}
+	queue = (lfq_t *)memory;
+
+	queue->hazards = HazardDomainCreate(HAZARDS_PER_THREAD, NULL);
+	if (NULL == queue->hazards)
+	{
+		free(queue);
+		return NULL;
+	}
+
+	dummy = CreateNode(NULL, NULL);
+	if (NULL == dummy)
+	{
+		HazardDomainDestroy(queue->hazards);
+		free(queue);
+		return NULL;
+	}
+
+	queue->head = dummy;
+	queue->tail = dummy;
+	queue->size = 0;
+
+	return queue;
+}
+
+
+
+void LFQDestroy(lfq_t *queue)
+{
+	struct lfq_node *current = NULL;
+	struct lfq_node *next = NULL;
+
+	assert(NULL != queue);
+
+	for (current = queue->head; NULL != current; current = next)
+	{
+		next = current->next;
+		free(current);
+	}
+
+	HazardDomainDestroy(queue->hazards);
+	free(queue);
+}
+
+
+
+int LFQEnqueue(lfq_t *queue, void *data)
+{
+	hazard_record_t *record = NULL;
+	struct lfq_node *node = NULL;
+	struct lfq_node *tail = NULL;
+	struct lfq_node *next = NULL;
+
+	assert(NULL != queue);
+	assert(NULL != data);
+
+	record = HazardAcquire(queue->hazards);
+	if (NULL == record)
+	{
+		return 1;
+	}
+
+	node = CreateNode(record, data);
+	if (NULL == node)
+	{
+		return 1;
+	}
+
+	/* counted before it is linked so a racing dequeue never underflows */
+	__atomic_add_fetch(&queue->size, 1, __ATOMIC_RELAXED);
+
+	for (;;)
+	{
+		tail = (struct lfq_node *)HazardProtect(record, HP_HEAD,
+												(void **)&queue->tail);
+		next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+
+		if (tail != __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE))
+		{
+			continue;
+		}
+
+		if (NULL != next)
+		{
+			/* tail is lagging - help the other producer finish */
+			__atomic_compare_exchange_n(&queue->tail, &tail, next, 0,
+										__ATOMIC_RELEASE, __ATOMIC_RELAXED);
+			continue;
+		}
+
+		if (__atomic_compare_exchange_n(&tail->next, &next, node, 0,
+										__ATOMIC_RELEASE, __ATOMIC_RELAXED))
+		{
+			break;
+		}
+	}
+
+	__atomic_compare_exchange_n(&queue->tail, &tail, node, 0,
+								__ATOMIC_RELEASE, __ATOMIC_RELAXED);
+	HazardClear(record);
+
+	return 0;
+}
+
+
+
+void *LFQDequeue(lfq_t *queue)
+{
+	hazard_record_t *record = NULL;
+	struct lfq_node *head = NULL;
+	struct lfq_node *tail = NULL;
+	struct lfq_node *next = NULL;
+	void *data = NULL;
+
+	assert(NULL != queue);
+
+	record = HazardAcquire(queue->hazards);
+	if (NULL == record)
+	{
+		return NULL;
+	}
+
+	for (;;)
+	{
+		head = (struct lfq_node *)HazardProtect(record, HP_HEAD,
+												(void **)&queue->head);
+		tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+		next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+		HazardSet(record, HP_NEXT, next);
+
+		if (head != __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE))
+		{
+			continue;
+		}
+
+		if (NULL == next)
+		{
+			HazardClear(record);
+			return NULL;
+		}
+
+		if (head == tail)
+		{
+			__atomic_compare_exchange_n(&queue->tail, &tail, next, 0,
+										__ATOMIC_RELEASE, __ATOMIC_RELAXED);
+			continue;
+		}
+
+		data = next->data;
+		if (__atomic_compare_exchange_n(&queue->head, &head, next, 0,
+										__ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+		{
+			break;
+		}
+	}
+
+	HazardClear(record);
+	__atomic_sub_fetch(&queue->size, 1, __ATOMIC_RELAXED);
+
+	/* the old dummy goes back to this thread's node cache once no other
+	   thread holds a hazard on it; on failure it is leaked, not reused */
+	HazardRetire(record, head);
+
+	return data;
+}
+
+
+
+size_t LFQSize(const lfq_t *queue)
+{
+	assert(NULL != queue);
+	return __atomic_load_n(&queue->size, __ATOMIC_RELAXED);
+}
+
+
+
+int LFQIsEmpty(const lfq_t *queue)
+{
+	hazard_record_t *record = NULL;
+	struct lfq_node *head = NULL;
+	int is_empty = 0;
+
+	assert(NULL != queue);
+
+	record = HazardAcquire(queue->hazards);
+	if (NULL == record)
+	{
+		return (0 == LFQSize(queue));
+	}
+
+	head = (struct lfq_node *)HazardProtect(record, HP_HEAD,
+												(void **)&queue->head);
+	is_empty = (NULL == __atomic_load_n(&head->next, __ATOMIC_ACQUIRE));
+	HazardClear(record);
+
+	return is_empty;
+}
+
+
+/**************************************** Helpers *****************************/
+static struct lfq_node *CreateNode(hazard_record_t *record, void *data)
+{
+	struct lfq_node *node = NULL;
+
+	if (NULL != record)
+	{
+		node = (struct lfq_node *)HazardGetBlock(record);
+	}
+
+	if (NULL == node)
+	{
+		node = (struct lfq_node *)malloc(sizeof(struct lfq_node));
+		if (NULL == node)
+		{
+			return NULL;
+		}
+	}
+
+	node->data = data;
+	node->next = NULL;
+
+	return node;
+}
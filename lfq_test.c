@@ -0,0 +1,222 @@
+/*
+   Code by: Or Yamin
+   Project: Lock-free queue (Michael-Scott) - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <pthread.h> /* pthread_create() pthread_join() */
+
+#include "lfq.h"
+
+#define PRODUCERS 4
+#define CONSUMERS 4
+#define ITEMS_PER_PRODUCER 20000
+#define TOTAL_ITEMS (PRODUCERS * ITEMS_PER_PRODUCER)
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+struct item
+{
+	int producer;
+	int seq;
+};
+
+struct consumer_arg
+{
+	lfq_t *queue;
+	int taken;
+	int out_of_order;
+};
+
+static int failures = 0;
+static struct item items[TOTAL_ITEMS];
+static int seen[TOTAL_ITEMS];
+static int consumed = 0;
+
+static void TestEmpty(void);
+static void TestFifo(void);
+static void TestConcurrent(void);
+static void *Produce(void *arg);
+static void *Consume(void *arg);
+
+
+int main(void)
+{
+	TestEmpty();
+	TestFifo();
+	TestConcurrent();
+
+	if (0 == failures)
+	{
+		puts("lfq: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestEmpty(void)
+{
+	lfq_t *queue = LFQCreate();
+
+	CHECK(NULL != queue);
+	CHECK(LFQIsEmpty(queue));
+	CHECK(0 == LFQSize(queue));
+	CHECK(NULL == LFQDequeue(queue));
+
+	LFQDestroy(queue);
+}
+
+static void TestFifo(void)
+{
+	lfq_t *queue = LFQCreate();
+	int values[100];
+	int i = 0;
+
+	for (i = 0; i < 100; ++i)
+	{
+		values[i] = i;
+		CHECK(0 == LFQEnqueue(queue, &values[i]));
+	}
+	CHECK(100 == LFQSize(queue));
+
+	for (i = 0; i < 50; ++i)
+	{
+		CHECK(&values[i] == LFQDequeue(queue));
+	}
+	CHECK(50 == LFQSize(queue));
+
+	/* refill behind the remaining half */
+	for (i = 0; i < 50; ++i)
+	{
+		CHECK(0 == LFQEnqueue(queue, &values[i]));
+	}
+	for (i = 50; i < 100; ++i)
+	{
+		CHECK(&values[i] == LFQDequeue(queue));
+	}
+	for (i = 0; i < 50; ++i)
+	{
+		CHECK(&values[i] == LFQDequeue(queue));
+	}
+
+	CHECK(LFQIsEmpty(queue));
+	CHECK(NULL == LFQDequeue(queue));
+
+	/* elements still queued are not the queue's to free */
+	CHECK(0 == LFQEnqueue(queue, &values[0]));
+	LFQDestroy(queue);
+}
+
+/* every item comes out exactly once, and each consumer sees the items of
+   one producer in the order they were enqueued */
+static void TestConcurrent(void)
+{
+	lfq_t *queue = LFQCreate();
+	pthread_t producers[PRODUCERS];
+	pthread_t consumers[CONSUMERS];
+	struct consumer_arg args[CONSUMERS];
+	int taken = 0;
+	int i = 0;
+
+	for (i = 0; i < PRODUCERS; ++i)
+	{
+		pthread_create(&producers[i], NULL, Produce, queue);
+	}
+	for (i = 0; i < CONSUMERS; ++i)
+	{
+		args[i].queue = queue;
+		args[i].taken = 0;
+		args[i].out_of_order = 0;
+		pthread_create(&consumers[i], NULL, Consume, &args[i]);
+	}
+
+	for (i = 0; i < PRODUCERS; ++i)
+	{
+		pthread_join(producers[i], NULL);
+	}
+	for (i = 0; i < CONSUMERS; ++i)
+	{
+		pthread_join(consumers[i], NULL);
+		taken += args[i].taken;
+		CHECK(0 == args[i].out_of_order);
+	}
+
+	CHECK(TOTAL_ITEMS == taken);
+	for (i = 0; i < TOTAL_ITEMS; ++i)
+	{
+		CHECK(1 == seen[i]);
+	}
+	CHECK(LFQIsEmpty(queue));
+
+	LFQDestroy(queue);
+}
+
+static void *Produce(void *arg)
+{
+	static int next_producer = 0;
+	lfq_t *queue = (lfq_t *)arg;
+	int producer = __atomic_fetch_add(&next_producer, 1, __ATOMIC_RELAXED);
+	struct item *item = NULL;
+	int i = 0;
+
+	for (i = 0; i < ITEMS_PER_PRODUCER; ++i)
+	{
+		item = &items[producer * ITEMS_PER_PRODUCER + i];
+		item->producer = producer;
+		item->seq = i;
+		while (0 != LFQEnqueue(queue, item))
+		{
+		}
+	}
+
+	return NULL;
+}
+
+static void *Consume(void *arg)
+{
+	struct consumer_arg *consumer = (struct consumer_arg *)arg;
+	int last_seq[PRODUCERS];
+	struct item *item = NULL;
+	int i = 0;
+
+	for (i = 0; i < PRODUCERS; ++i)
+	{
+		last_seq[i] = -1;
+	}
+
+	while (TOTAL_ITEMS > __atomic_load_n(&consumed, __ATOMIC_RELAXED))
+	{
+		item = (struct item *)LFQDequeue(consumer->queue);
+		if (NULL == item)
+		{
+			continue;
+		}
+
+		if (item->seq <= last_seq[item->producer])
+		{
+			++consumer->out_of_order;
+		}
+		last_seq[item->producer] = item->seq;
+
+		++seen[item->producer * ITEMS_PER_PRODUCER + item->seq];
+		++consumer->taken;
+		__atomic_fetch_add(&consumed, 1, __ATOMIC_RELAXED);
+	}
+
+	return NULL;
+}
@@ -0,0 +1,325 @@
+/*
+   Code by: Or Yamin
+   Project: Lock-free sorted list (Harris-Michael) for concurrent sets
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* A node is deleted in two steps: first the low bit of its next pointer is
+   set (logical delete), then it is unlinked with a CAS on its predecessor.
+   Any thread that walks past a marked node unlinks it, so no operation ever
+   waits for another. Unlinked nodes are reclaimed through hazard pointers. */
+
+#include <stdlib.h> /* malloc free size_t */
+#include <assert.h> /* assert */
+#include <stdint.h> /* uintptr_t */
+
+#include "hazard.h"
+#include "sortedlist.h"
+#include "lfsortedlist.h"
+
+#define HAZARDS_PER_THREAD 3
+#define HP_NEXT 0
+#define HP_CUR 1
+#define HP_PREV 2
+
+#define MARK_BIT ((uintptr_t)1)
+#define IS_MARKED(ptr) (0 != ((uintptr_t)(ptr) & MARK_BIT))
+#define MARK(ptr) ((struct lfsortedlist_node *)((uintptr_t)(ptr) | MARK_BIT))
+#define UNMARK(ptr) ((struct lfsortedlist_node *)((uintptr_t)(ptr) & ~MARK_BIT))
+
+struct lfsortedlist_node
+{
+	void *data;
+	struct lfsortedlist_node *next;
+};
+
+struct lfsortedlist
+{
+	struct lfsortedlist_node head;
+	sortedlist_cmp_func_t compare;
+	size_t size;
+	hazard_domain_t *hazards;
+};
+
+/* where a search stopped: *prev is the link that pointed to cur */
+struct position
+{
+	struct lfsortedlist_node **prev;
+	struct lfsortedlist_node *cur;
+	struct lfsortedlist_node *next;
+};
+
+static int Search(lfsortedlist_t *list, hazard_record_t *record,
+									const void *key, struct position *pos);
+static struct lfsortedlist_node *LoadLink(struct lfsortedlist_node **link);
+static int CasLink(struct lfsortedlist_node **link,
+			struct lfsortedlist_node *expected, struct lfsortedlist_node *desired);
+
+
+lfsortedlist_t *LFSortedlistCreate(sortedlist_cmp_func_t compare)
+{
+	lfsortedlist_t *list = NULL;
+
+	assert(NULL != compare);
+
+	list = (lfsortedlist_t *)malloc(sizeof(lfsortedlist_t));
+	if (NULL == list)
+	{
+		return NULL;
+	}
+
+	list->hazards = HazardDomainCreate(HAZARDS_PER_THREAD, NULL);
+	if (NULL == list->hazards)
+	{
+		free(list);
+		return NULL;
+	}
+
+	list->head.data = NULL;
+	list->head.next = NULL;
+	list->compare = compare;
+	list->size = 0;
+
+	return list;
+}
+
+
+
+void LFSortedlistDestroy(lfsortedlist_t *list)
+{
+	struct lfsortedlist_node *current = NULL;
+	struct lfsortedlist_node *next = NULL;
+
+	assert(NULL != list);
+
+	for (current = UNMARK(list->head.next); NULL != current; current = next)
+	{
+		next = UNMARK(current->next);
+		free(current);
+	}
+
+	HazardDomainDestroy(list->hazards);
+	free(list);
+}
+
+
+
+int LFSortedlistInsert(lfsortedlist_t *list, void *data)
+{
+	hazard_record_t *record = NULL;
+	struct lfsortedlist_node *node = NULL;
+	struct position pos;
+
+	assert(NULL != list);
+	assert(NULL != data);
+
+	record = HazardAcquire(list->hazards);
+	if (NULL == record)
+	{
+		return -1;
+	}
+
+	node = (struct lfsortedlist_node *)HazardGetBlock(record);
+	if (NULL == node)
+	{
+		node = (struct lfsortedlist_node *)malloc(
+											sizeof(struct lfsortedlist_node));
+		if (NULL == node)
+		{
+			return -1;
+		}
+	}
+	node->data = data;
+
+	for (;;)
+	{
+		if (Search(list, record, data, &pos))
+		{
+			HazardClear(record);
+			free(node);
+			return 1;
+		}
+
+		node->next = pos.cur;
+		if (CasLink(pos.prev, pos.cur, node))
+		{
+			break;
+		}
+	}
+
+	HazardClear(record);
+	__atomic_add_fetch(&list->size, 1, __ATOMIC_RELAXED);
+
+	return 0;
+}
+
+
+
+void *LFSortedlistRemove(lfsortedlist_t *list, const void *key)
+{
+	hazard_record_t *record = NULL;
+	struct position pos;
+	void *data = NULL;
+
+	assert(NULL != list);
+	assert(NULL != key);
+
+	record = HazardAcquire(list->hazards);
+	if (NULL == record)
+	{
+		return NULL;
+	}
+
+	for (;;)
+	{
+		if (!Search(list, record, key, &pos))
+		{
+			HazardClear(record);
+			return NULL;
+		}
+
+		/* logical delete - whoever sets the mark owns the removal */
+		if (CasLink(&pos.cur->next, pos.next, MARK(pos.next)))
+		{
+			break;
+		}
+	}
+
+	data = pos.cur->data;
+	__atomic_sub_fetch(&list->size, 1, __ATOMIC_RELAXED);
+
+	if (CasLink(pos.prev, pos.cur, pos.next))
+	{
+		HazardClear(record);
+		HazardRetire(record, pos.cur);
+	}
+	else
+	{
+		/* someone changed the predecessor - a search unlinks it for us */
+		Search(list, record, key, &pos);
+		HazardClear(record);
+	}
+
+	return data;
+}
+
+
+
+void *LFSortedlistFind(lfsortedlist_t *list, const void *key)
+{
+	hazard_record_t *record = NULL;
+	struct position pos;
+	void *data = NULL;
+
+	assert(NULL != list);
+	assert(NULL != key);
+
+	record = HazardAcquire(list->hazards);
+	if (NULL == record)
+	{
+		return NULL;
+	}
+
+	if (Search(list, record, key, &pos))
+	{
+		data = pos.cur->data;
+	}
+
+	HazardClear(record);
+
+	return data;
+}
+
+
+
+size_t LFSortedlistSize(const lfsortedlist_t *list)
+{
+	assert(NULL != list);
+	return __atomic_load_n(&list->size, __ATOMIC_RELAXED);
+}
+
+
+
+int LFSortedlistIsEmpty(const lfsortedlist_t *list)
+{
+	assert(NULL != list);
+	return (0 == LFSortedlistSize(list));
+}
+
+
+/**************************************** Helpers *****************************/
+/* finds the first node whose data is not less than key and returns 1 if it
+   compares equal; marked nodes met on the way are unlinked and retired.
+   On return cur and its predecessor are protected by hazard pointers. */
+static int Search(lfsortedlist_t *list, hazard_record_t *record,
+									const void *key, struct position *pos)
+{
+	struct lfsortedlist_node *prev_node = NULL;
+	int cmp_result = 0;
+
+try_again:
+	pos->prev = &list->head.next;
+	pos->cur = LoadLink(pos->prev);
+	HazardSet(record, HP_CUR, pos->cur);
+	if (pos->cur != LoadLink(pos->prev))
+	{
+		goto try_again;
+	}
+
+	for (;;)
+	{
+		if (NULL == pos->cur)
+		{
+			return 0;
+		}
+
+		pos->next = LoadLink(&pos->cur->next);
+		HazardSet(record, HP_NEXT, UNMARK(pos->next));
+		if (pos->next != LoadLink(&pos->cur->next) ||
+			pos->cur != LoadLink(pos->prev))
+		{
+			goto try_again;
+		}
+
+		if (!IS_MARKED(pos->next))
+		{
+			cmp_result = list->compare(pos->cur->data, key);
+			if (0 <= cmp_result)
+			{
+				return (0 == cmp_result);
+			}
+
+			prev_node = pos->cur;
+			HazardSet(record, HP_PREV, prev_node);
+			pos->prev = &prev_node->next;
+		}
+		else
+		{
+			pos->next = UNMARK(pos->next);
+			if (!CasLink(pos->prev, pos->cur, pos->next))
+			{
+				goto try_again;
+			}
+			HazardRetire(record, pos->cur);
+		}
+
+		pos->cur = UNMARK(pos->next);
+		HazardSet(record, HP_CUR, pos->cur);
+	}
+}
+
+static struct lfsortedlist_node *LoadLink(struct lfsortedlist_node **link)
+{
+	return __atomic_load_n(link, __ATOMIC_ACQUIRE);
+}
+
+static int CasLink(struct lfsortedlist_node **link,
+			struct lfsortedlist_node *expected, struct lfsortedlist_node *desired)
+{
+	return __atomic_compare_exchange_n(link, &expected, desired, 0,
+										__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
@@ -0,0 +1,199 @@
+/*
+   Code by: Or Yamin
+   Project: Lock-free sorted list (Harris-Michael) - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <pthread.h> /* pthread_create() pthread_join() */
+
+#include "lfsortedlist.h"
+
+#define THREADS 4
+#define KEYS_PER_THREAD 500
+#define SHARED_KEYS 200
+#define KEYS (THREADS * KEYS_PER_THREAD + SHARED_KEYS)
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+struct worker_arg
+{
+	lfsortedlist_t *list;
+	int first_key;
+	int shared_inserted;
+	int errors;
+};
+
+static int failures = 0;
+static int keys[KEYS];
+
+static void TestSet(void);
+static void TestConcurrent(void);
+static void *Work(void *arg);
+static int CompareInts(const void *data1, const void *data2);
+
+
+int main(void)
+{
+	size_t i = 0;
+
+	for (i = 0; i < KEYS; ++i)
+	{
+		keys[i] = (int)i;
+	}
+
+	TestSet();
+	TestConcurrent();
+
+	if (0 == failures)
+	{
+		puts("lfsortedlist: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestSet(void)
+{
+	lfsortedlist_t *list = LFSortedlistCreate(CompareInts);
+	int order[] = {5, 1, 9, 3, 7};
+	int duplicate = 5;
+	int missing = 4;
+	size_t i = 0;
+
+	CHECK(NULL != list);
+	CHECK(LFSortedlistIsEmpty(list));
+	CHECK(NULL == LFSortedlistFind(list, &missing));
+	CHECK(NULL == LFSortedlistRemove(list, &missing));
+
+	for (i = 0; i < 5; ++i)
+	{
+		CHECK(0 == LFSortedlistInsert(list, &keys[order[i]]));
+	}
+	CHECK(5 == LFSortedlistSize(list));
+
+	/* a set: an equal element is refused, and the first one stays */
+	CHECK(1 == LFSortedlistInsert(list, &duplicate));
+	CHECK(5 == LFSortedlistSize(list));
+	CHECK(&keys[5] == LFSortedlistFind(list, &duplicate));
+
+	CHECK(NULL == LFSortedlistFind(list, &missing));
+	CHECK(&keys[9] == LFSortedlistFind(list, &keys[9]));
+
+	CHECK(&keys[5] == LFSortedlistRemove(list, &duplicate));
+	CHECK(NULL == LFSortedlistFind(list, &duplicate));
+	CHECK(NULL == LFSortedlistRemove(list, &duplicate));
+	CHECK(4 == LFSortedlistSize(list));
+
+	/* removed keys can be inserted again */
+	CHECK(0 == LFSortedlistInsert(list, &keys[5]));
+	CHECK(&keys[5] == LFSortedlistFind(list, &duplicate));
+
+	LFSortedlistDestroy(list);
+}
+
+/* every thread inserts, finds and removes its own keys while all of them
+   race to insert the same shared keys, each of which must go in once */
+static void TestConcurrent(void)
+{
+	lfsortedlist_t *list = LFSortedlistCreate(CompareInts);
+	pthread_t threads[THREADS];
+	struct worker_arg args[THREADS];
+	int shared_inserted = 0;
+	int i = 0;
+
+	for (i = 0; i < THREADS; ++i)
+	{
+		args[i].list = list;
+		args[i].first_key = i * KEYS_PER_THREAD;
+		args[i].shared_inserted = 0;
+		args[i].errors = 0;
+		pthread_create(&threads[i], NULL, Work, &args[i]);
+	}
+	for (i = 0; i < THREADS; ++i)
+	{
+		pthread_join(threads[i], NULL);
+		shared_inserted += args[i].shared_inserted;
+		CHECK(0 == args[i].errors);
+	}
+
+	CHECK(SHARED_KEYS == shared_inserted);
+
+	/* each thread removed its even keys and kept its odd ones */
+	CHECK(THREADS * KEYS_PER_THREAD / 2 + SHARED_KEYS ==
+												LFSortedlistSize(list));
+	for (i = 0; i < KEYS; ++i)
+	{
+		if (i < THREADS * KEYS_PER_THREAD && 0 == i % 2)
+		{
+			CHECK(NULL == LFSortedlistFind(list, &keys[i]));
+		}
+		else
+		{
+			CHECK(&keys[i] == LFSortedlistFind(list, &keys[i]));
+		}
+	}
+
+	LFSortedlistDestroy(list);
+}
+
+static void *Work(void *arg)
+{
+	struct worker_arg *worker = (struct worker_arg *)arg;
+	int *own = &keys[worker->first_key];
+	int *shared = &keys[THREADS * KEYS_PER_THREAD];
+	int i = 0;
+
+	/* the own keys go in back to front and interleaved with the shared
+	   ones, so inserts land all over the list */
+	for (i = KEYS_PER_THREAD - 1; 0 <= i; --i)
+	{
+		if (0 != LFSortedlistInsert(worker->list, &own[i]))
+		{
+			++worker->errors;
+		}
+
+		if (i < SHARED_KEYS &&
+				0 == LFSortedlistInsert(worker->list, &shared[i]))
+		{
+			++worker->shared_inserted;
+		}
+	}
+
+	for (i = 0; i < KEYS_PER_THREAD; ++i)
+	{
+		if (&own[i] != LFSortedlistFind(worker->list, &own[i]))
+		{
+			++worker->errors;
+		}
+	}
+
+	for (i = 0; i < KEYS_PER_THREAD; i += 2)
+	{
+		if (&own[i] != LFSortedlistRemove(worker->list, &own[i]))
+		{
+			++worker->errors;
+		}
+	}
+
+	return NULL;
+}
+
+static int CompareInts(const void *data1, const void *data2)
+{
+	return *(const int *)data1 - *(const int *)data2;
+}
@@ -0,0 +1,170 @@
+/*
+   Code by: Or Yamin
+   Project: Lock-free stack (Treiber) for shared free-lists
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* The head is a {pointer, tag} pair swapped with a double-width CAS: build
+   with -mcx16 (or link -latomic) on x86-64. Pushed blocks are linked through
+   their first word, so a block must be at least sizeof(void *) and must stay
+   mapped while the stack is in use (pool memory, not free()d memory). */
+
+#include <stdlib.h> /* malloc free size_t */
+#include <assert.h> /* assert */
+
+#include "lfstack.h"
+
+struct lfstack_head
+{
+	void *top;
+	size_t tag;
+} __attribute__((aligned(2 * sizeof(void *))));
+
+struct lfstack
+{
+	struct lfstack_head head;
+};
+
+static void SetLink(void *block, void *next);
+static void *GetLink(void *block);
+
+
+lfstack_t *LFStackCreate(void)
+{
+	lfstack_t *stack = (lfstack_t *)malloc(sizeof(lfstack_t));
+	if (NULL == stack)
+	{
+		return NULL;
+	}
+
+	stack->head.top = NULL;
+	stack->head.tag = 0;
+
+	return stack;
+}
+
+
+
+void LFStackDestroy(lfstack_t *stack)
+{
+	assert(NULL != stack);
+	free(stack);
+}
+
+
+
+void LFStackPush(lfstack_t *stack, void *block)
+{
+	assert(NULL != stack);
+	assert(NULL != block);
+
+	LFStackPushChain(stack, block, block);
+}
+
+
+
+void LFStackPushChain(lfstack_t *stack, void *first, void *last)
+{
+	struct lfstack_head old_head;
+	struct lfstack_head new_head;
+
+	assert(NULL != stack);
+	assert(NULL != first);
+	assert(NULL != last);
+
+	__atomic_load(&stack->head, &old_head, __ATOMIC_RELAXED);
+	do
+	{
+		SetLink(last, old_head.top);
+		new_head.top = first;
+		new_head.tag = old_head.tag + 1;
+	}
+	while (!__atomic_compare_exchange(&stack->head, &old_head, &new_head, 0,
+										__ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+
+
+void *LFStackPop(lfstack_t *stack)
+{
+	struct lfstack_head old_head;
+	struct lfstack_head new_head;
+
+	assert(NULL != stack);
+
+	__atomic_load(&stack->head, &old_head, __ATOMIC_ACQUIRE);
+	do
+	{
+		if (NULL == old_head.top)
+		{
+			return NULL;
+		}
+
+		/* the block may already be popped and reused by another thread, in
+		   which case this link is garbage - the tag makes the CAS fail */
+		new_head.top = GetLink(old_head.top);
+		new_head.tag = old_head.tag + 1;
+	}
+	while (!__atomic_compare_exchange(&stack->head, &old_head, &new_head, 0,
+										__ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+
+	return old_head.top;
+}
+
+
+
+void *LFStackPopAll(lfstack_t *stack)
+{
+	struct lfstack_head old_head;
+	struct lfstack_head new_head;
+
+	assert(NULL != stack);
+
+	__atomic_load(&stack->head, &old_head, __ATOMIC_ACQUIRE);
+	do
+	{
+		if (NULL == old_head.top)
+		{
+			return NULL;
+		}
+
+		new_head.top = NULL;
+		new_head.tag = old_head.tag + 1;
+	}
+	while (!__atomic_compare_exchange(&stack->head, &old_head, &new_head, 0,
+										__ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+
+	return old_head.top;
+}
+
+
+
+void *LFStackNext(void *block)
+{
+	assert(NULL != block);
+	return GetLink(block);
+}
+
+
+
+int LFStackIsEmpty(const lfstack_t *stack)
+{
+	assert(NULL != stack);
+	return (NULL == __atomic_load_n(&stack->head.top, __ATOMIC_RELAXED));
+}
+
+
+/**************************************** Helpers *****************************/
+static void SetLink(void *block, void *next)
+{
+	__atomic_store_n((void **)block, next, __ATOMIC_RELAXED);
+}
+
+static void *GetLink(void *block)
+{
+	return __atomic_load_n((void **)block, __ATOMIC_RELAXED);
+}
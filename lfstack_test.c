@@ -0,0 +1,180 @@
+/*
+   Code by: Or Yamin
+   Project: Lock-free stack (Treiber) - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <pthread.h> /* pthread_create() pthread_join() */
+
+#include "lfstack.h"
+
+#define BLOCKS 64
+#define THREADS 8
+#define ROUNDS 50000
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+/* the stack links blocks through their first word */
+struct block
+{
+	void *link;
+	int id;
+	int owners;
+};
+
+static int failures = 0;
+static struct block blocks[BLOCKS];
+
+static void TestLifo(void);
+static void TestChains(void);
+static void TestConcurrent(void);
+static void *Churn(void *arg);
+
+
+int main(void)
+{
+	TestLifo();
+	TestChains();
+	TestConcurrent();
+
+	if (0 == failures)
+	{
+		puts("lfstack: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestLifo(void)
+{
+	lfstack_t *stack = LFStackCreate();
+	int i = 0;
+
+	CHECK(NULL != stack);
+	CHECK(LFStackIsEmpty(stack));
+	CHECK(NULL == LFStackPop(stack));
+
+	for (i = 0; i < 4; ++i)
+	{
+		LFStackPush(stack, &blocks[i]);
+	}
+	CHECK(!LFStackIsEmpty(stack));
+
+	for (i = 3; 0 <= i; --i)
+	{
+		CHECK(&blocks[i] == LFStackPop(stack));
+	}
+	CHECK(LFStackIsEmpty(stack));
+
+	LFStackDestroy(stack);
+}
+
+static void TestChains(void)
+{
+	lfstack_t *stack = LFStackCreate();
+	void *block = NULL;
+	int i = 0;
+
+	/* 0 -> 1 -> 2, pushed in one go on top of 3 */
+	LFStackPush(stack, &blocks[3]);
+	for (i = 0; i < 2; ++i)
+	{
+		blocks[i].link = &blocks[i + 1];
+	}
+	LFStackPushChain(stack, &blocks[0], &blocks[2]);
+
+	for (i = 0, block = LFStackPopAll(stack); NULL != block;
+											++i, block = LFStackNext(block))
+	{
+		CHECK(&blocks[i] == block);
+	}
+	CHECK(4 == i);
+	CHECK(LFStackIsEmpty(stack));
+	CHECK(NULL == LFStackPopAll(stack));
+
+	LFStackDestroy(stack);
+}
+
+/* threads share one free-list: a popped block must never be held by two
+   threads at once, and every block must be back at the end */
+static void TestConcurrent(void)
+{
+	lfstack_t *stack = LFStackCreate();
+	pthread_t threads[THREADS];
+	int seen[BLOCKS] = {0};
+	struct block *block = NULL;
+	int count = 0;
+	int i = 0;
+
+	for (i = 0; i < BLOCKS; ++i)
+	{
+		blocks[i].id = i;
+		blocks[i].owners = 0;
+		LFStackPush(stack, &blocks[i]);
+	}
+
+	for (i = 0; i < THREADS; ++i)
+	{
+		pthread_create(&threads[i], NULL, Churn, stack);
+	}
+	for (i = 0; i < THREADS; ++i)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	while (NULL != (block = (struct block *)LFStackPop(stack)))
+	{
+		++seen[block->id];
+		++count;
+		CHECK(0 == block->owners);
+	}
+
+	CHECK(BLOCKS == count);
+	for (i = 0; i < BLOCKS; ++i)
+	{
+		CHECK(1 == seen[i]);
+	}
+
+	LFStackDestroy(stack);
+}
+
+static void *Churn(void *arg)
+{
+	lfstack_t *stack = (lfstack_t *)arg;
+	struct block *block = NULL;
+	int i = 0;
+
+	for (i = 0; i < ROUNDS; ++i)
+	{
+		block = (struct block *)LFStackPop(stack);
+		if (NULL == block)
+		{
+			continue;
+		}
+
+		if (0 != __atomic_fetch_add(&block->owners, 1, __ATOMIC_RELAXED))
+		{
+			__atomic_fetch_add(&failures, 1, __ATOMIC_RELAXED);
+		}
+		__atomic_fetch_sub(&block->owners, 1, __ATOMIC_RELAXED);
+
+		LFStackPush(stack, block);
+	}
+
+	return NULL;
+}
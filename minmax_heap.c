@@ -0,0 +1,335 @@
+/*
+   Code by: Or Yamin
+   Project: min-max heap (double-ended priority queue)
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* Takes the same heap_compare_func_t as heap.c: "max" is the element
+   HeapPeek would return (cmp(a, b) > 0 puts a first), "min" is the one
+   HeapPeek would return last. Levels alternate: every node on an even level
+   (the root's) is the max of its subtree, every node on an odd level is the
+   min of its subtree, so both ends are at most one step from the root. */
+
+#include <assert.h> /* assert */
+#include <stdlib.h> /* size_t malloc free */
+
+#include "heap.h"
+#include "dvector.h"
+#include "minmax_heap.h"
+
+#define ADDRESS_SIZE sizeof(void *)
+#define INIT_VECTOR_SIZE 8
+#define ROOT 0
+
+struct minmax_heap
+{
+	dvector_t *vector;
+	heap_compare_func_t cmp_func;
+};
+
+static void *RemoveAt(minmax_heap_t *heap, size_t index);
+static void BubbleUp(minmax_heap_t *heap, size_t index);
+static void BubbleUpLevels(minmax_heap_t *heap, size_t index, int is_max);
+static void TrickleDown(minmax_heap_t *heap, size_t index);
+static size_t FindExtremeBelow(minmax_heap_t *heap, size_t index, int is_max);
+static int IsBefore(const minmax_heap_t *heap, void *data1, void *data2,
+																int is_max);
+static int IsMaxLevel(size_t index);
+static void SwapElements(void **elements, size_t index1, size_t index2);
+static void **GetElements(minmax_heap_t *heap);
+static size_t GetParentIndex(size_t index);
+static size_t GetMinIndex(minmax_heap_t *heap);
+
+
+minmax_heap_t *MinMaxHeapCreate(heap_compare_func_t compare_func)
+{
+	minmax_heap_t *heap = NULL;
+
+	assert(NULL != compare_func);
+
+	heap = (minmax_heap_t *)malloc(sizeof(minmax_heap_t));
+	if (NULL == heap)
+	{
+		return NULL;
+	}
+
+	heap->vector = DvectorCreate(INIT_VECTOR_SIZE, ADDRESS_SIZE);
+	if (NULL == heap->vector)
+	{
+		free(heap);
+		return NULL;
+	}
+
+	heap->cmp_func = compare_func;
+
+	return heap;
+}
+
+void MinMaxHeapDestroy(minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	DvectorDestroy(heap->vector);
+	free(heap);
+}
+
+int MinMaxHeapPush(minmax_heap_t *heap, void *data)
+{
+	assert(NULL != heap);
+
+	if (0 != DvectorPushBack(heap->vector, &data))
+	{
+		return 1;
+	}
+
+	BubbleUp(heap, MinMaxHeapSize(heap) - 1);
+
+	return 0;
+}
+
+void *MinMaxHeapPeekMax(minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(!MinMaxHeapIsEmpty(heap));
+
+	return GetElements(heap)[ROOT];
+}
+
+void *MinMaxHeapPeekMin(minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(!MinMaxHeapIsEmpty(heap));
+
+	return GetElements(heap)[GetMinIndex(heap)];
+}
+
+void *MinMaxHeapPopMax(minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(!MinMaxHeapIsEmpty(heap));
+
+	return RemoveAt(heap, ROOT);
+}
+
+void *MinMaxHeapPopMin(minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(!MinMaxHeapIsEmpty(heap));
+
+	return RemoveAt(heap, GetMinIndex(heap));
+}
+
+size_t MinMaxHeapSize(const minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	return DvectorSize(heap->vector);
+}
+
+int MinMaxHeapIsEmpty(const minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	return (0 == MinMaxHeapSize(heap));
+}
+
+
+/**************************************** Helpers *****************************/
+/* the last element fills the hole and trickles down from there; index is
+   the root or a child of it, so the filler never has to go up */
+static void *RemoveAt(minmax_heap_t *heap, size_t index)
+{
+	void **elements = GetElements(heap);
+	size_t last_index = MinMaxHeapSize(heap) - 1;
+	void *data = elements[index];
+
+	elements[index] = elements[last_index];
+	DvectorPopBack(heap->vector);
+
+	if (index < last_index)
+	{
+		TrickleDown(heap, index);
+	}
+
+	return data;
+}
+
+/* a new leaf first decides, against its parent, whether it belongs to the
+   max levels or the min levels, then climbs only levels of that kind */
+static void BubbleUp(minmax_heap_t *heap, size_t index)
+{
+	void **elements = GetElements(heap);
+	size_t parent_index = 0;
+	int is_max = IsMaxLevel(index);
+
+	if (ROOT == index)
+	{
+		return;
+	}
+
+	parent_index = GetParentIndex(index);
+	if (IsBefore(heap, elements[parent_index], elements[index], is_max))
+	{
+		SwapElements(elements, index, parent_index);
+		BubbleUpLevels(heap, parent_index, !is_max);
+	}
+	else
+	{
+		BubbleUpLevels(heap, index, is_max);
+	}
+}
+
+static void BubbleUpLevels(minmax_heap_t *heap, size_t index, int is_max)
+{
+	void **elements = GetElements(heap);
+	void *data = elements[index];
+	size_t grandparent_index = 0;
+
+	while (2 < index)
+	{
+		grandparent_index = GetParentIndex(GetParentIndex(index));
+		if (!IsBefore(heap, data, elements[grandparent_index], is_max))
+		{
+			break;
+		}
+
+		elements[index] = elements[grandparent_index];
+		index = grandparent_index;
+	}
+
+	elements[index] = data;
+}
+
+static void TrickleDown(minmax_heap_t *heap, size_t index)
+{
+	void **elements = GetElements(heap);
+	size_t extreme_index = 0;
+	int is_max = IsMaxLevel(index);
+
+	for (;;)
+	{
+		extreme_index = FindExtremeBelow(heap, index, is_max);
+		if (extreme_index == index ||
+			!IsBefore(heap, elements[extreme_index], elements[index], is_max))
+		{
+			return;
+		}
+
+		SwapElements(elements, index, extreme_index);
+
+		/* a child sits on a level of the other kind and already bounded its
+		   subtree from that side; what replaced it lies even further that
+		   way, so nothing below needs fixing */
+		if (GetParentIndex(extreme_index) == index)
+		{
+			return;
+		}
+
+		/* a grandchild: the element that came down may now be on the wrong
+		   side of its new parent */
+		if (IsBefore(heap, elements[GetParentIndex(extreme_index)],
+										elements[extreme_index], is_max))
+		{
+			SwapElements(elements, extreme_index,
+										GetParentIndex(extreme_index));
+		}
+
+		index = extreme_index;
+	}
+}
+
+/* the most extreme of index's children and grandchildren, or index itself
+   when it is a leaf */
+static size_t FindExtremeBelow(minmax_heap_t *heap, size_t index, int is_max)
+{
+	void **elements = GetElements(heap);
+	size_t size = MinMaxHeapSize(heap);
+	size_t first_child = 2 * index + 1;
+	size_t first_grandchild = 4 * index + 3;
+	size_t extreme_index = index;
+	size_t i = 0;
+
+	if (first_child >= size)
+	{
+		return index;
+	}
+
+	extreme_index = first_child;
+	if (first_child + 1 < size &&
+		IsBefore(heap, elements[first_child + 1], elements[first_child], is_max))
+	{
+		extreme_index = first_child + 1;
+	}
+
+	for (i = first_grandchild; i < first_grandchild + 4 && i < size; ++i)
+	{
+		if (IsBefore(heap, elements[i], elements[extreme_index], is_max))
+		{
+			extreme_index = i;
+		}
+	}
+
+	return extreme_index;
+}
+
+/* is_max: data1 goes first from the max end, otherwise from the min end */
+static int IsBefore(const minmax_heap_t *heap, void *data1, void *data2,
+																int is_max)
+{
+	int result = heap->cmp_func(data1, data2);
+
+	return is_max ? (0 < result) : (0 > result);
+}
+
+/* level of index is floor(log2(index + 1)); even levels hold the maxima */
+static int IsMaxLevel(size_t index)
+{
+	size_t level = 0;
+
+	for (++index; 1 < index; index >>= 1)
+	{
+		++level;
+	}
+
+	return (0 == level % 2);
+}
+
+static void SwapElements(void **elements, size_t index1, size_t index2)
+{
+	void *temp = elements[index1];
+
+	elements[index1] = elements[index2];
+	elements[index2] = temp;
+}
+
+/* the vector's buffer seen as an array; valid until the next push */
+static void **GetElements(minmax_heap_t *heap)
+{
+	return (void **)DvectorGetElement(heap->vector, 0);
+}
+
+static size_t GetParentIndex(size_t index)
+{
+	return (index - 1) / 2;
+}
+
+/* the min is the root itself or the lesser of its two children */
+static size_t GetMinIndex(minmax_heap_t *heap)
+{
+	void **elements = GetElements(heap);
+	size_t size = MinMaxHeapSize(heap);
+
+	if (1 == size)
+	{
+		return ROOT;
+	}
+
+	if (2 == size || IsBefore(heap, elements[1], elements[2], 0))
+	{
+		return 1;
+	}
+
+	return 2;
+}
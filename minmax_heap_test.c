@@ -0,0 +1,200 @@
+/*
+   Code by: Or Yamin
+   Project: min-max heap (double-ended priority queue) - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stdlib.h> /* rand() srand() */
+
+#include "minmax_heap.h"
+
+#define ITEMS 5000
+#define OPERATIONS 50000
+#define VALUE_RANGE 1000
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+static int failures = 0;
+static int items[ITEMS];
+
+static void TestSmall(void);
+static void TestDrainBothEnds(void);
+static void TestRandomOperations(void);
+static int FindLowest(const size_t *counts);
+static int FindHighest(const size_t *counts);
+static int CompareBigger(const void *data1, const void *data2);
+
+
+int main(void)
+{
+	size_t i = 0;
+
+	srand(17);
+	for (i = 0; i < ITEMS; ++i)
+	{
+		items[i] = rand() % VALUE_RANGE;
+	}
+
+	TestSmall();
+	TestDrainBothEnds();
+	TestRandomOperations();
+
+	if (0 == failures)
+	{
+		puts("minmax_heap: all tests passed");
+	}
+
+	return failures;
+}
+
+
+/* one and two elements, where max and min share the top levels */
+static void TestSmall(void)
+{
+	minmax_heap_t *heap = MinMaxHeapCreate(CompareBigger);
+	int values[] = {5, 2, 9};
+
+	CHECK(NULL != heap);
+	CHECK(MinMaxHeapIsEmpty(heap));
+
+	CHECK(0 == MinMaxHeapPush(heap, &values[0]));
+	CHECK(&values[0] == MinMaxHeapPeekMax(heap));
+	CHECK(&values[0] == MinMaxHeapPeekMin(heap));
+
+	MinMaxHeapPush(heap, &values[1]);
+	CHECK(&values[0] == MinMaxHeapPeekMax(heap));
+	CHECK(&values[1] == MinMaxHeapPeekMin(heap));
+
+	MinMaxHeapPush(heap, &values[2]);
+	CHECK(3 == MinMaxHeapSize(heap));
+	CHECK(&values[2] == MinMaxHeapPopMax(heap));
+	CHECK(&values[1] == MinMaxHeapPopMin(heap));
+	CHECK(&values[0] == MinMaxHeapPopMin(heap));
+	CHECK(MinMaxHeapIsEmpty(heap));
+
+	MinMaxHeapDestroy(heap);
+}
+
+/* popping from alternate ends meets in the middle */
+static void TestDrainBothEnds(void)
+{
+	minmax_heap_t *heap = MinMaxHeapCreate(CompareBigger);
+	int low = -1;
+	int high = VALUE_RANGE;
+	int *data = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		MinMaxHeapPush(heap, &items[i]);
+	}
+	CHECK(ITEMS == MinMaxHeapSize(heap));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		if (0 == i % 2)
+		{
+			data = (int *)MinMaxHeapPopMin(heap);
+			CHECK(low <= *data);
+			low = *data;
+		}
+		else
+		{
+			data = (int *)MinMaxHeapPopMax(heap);
+			CHECK(high >= *data);
+			high = *data;
+		}
+	}
+	CHECK(low <= high);
+	CHECK(MinMaxHeapIsEmpty(heap));
+
+	MinMaxHeapDestroy(heap);
+}
+
+/* pushes and pops from both ends in random order, checked against a count
+   of the values the heap should be holding */
+static void TestRandomOperations(void)
+{
+	minmax_heap_t *heap = MinMaxHeapCreate(CompareBigger);
+	size_t counts[VALUE_RANGE] = {0};
+	size_t size = 0;
+	int *data = NULL;
+	size_t next = 0;
+	size_t i = 0;
+
+	for (i = 0; i < OPERATIONS; ++i)
+	{
+		if (0 == size || 0 == rand() % 3)
+		{
+			data = &items[next];
+			next = (next + 1) % ITEMS;
+			CHECK(0 == MinMaxHeapPush(heap, data));
+			++counts[*data];
+			++size;
+		}
+		else if (0 == rand() % 2)
+		{
+			CHECK(FindLowest(counts) == *(int *)MinMaxHeapPeekMin(heap));
+			data = (int *)MinMaxHeapPopMin(heap);
+			CHECK(FindLowest(counts) == *data);
+			--counts[*data];
+			--size;
+		}
+		else
+		{
+			CHECK(FindHighest(counts) == *(int *)MinMaxHeapPeekMax(heap));
+			data = (int *)MinMaxHeapPopMax(heap);
+			CHECK(FindHighest(counts) == *data);
+			--counts[*data];
+			--size;
+		}
+
+		CHECK(size == MinMaxHeapSize(heap));
+	}
+
+	MinMaxHeapDestroy(heap);
+}
+
+static int FindLowest(const size_t *counts)
+{
+	int value = 0;
+
+	while (0 == counts[value])
+	{
+		++value;
+	}
+
+	return value;
+}
+
+static int FindHighest(const size_t *counts)
+{
+	int value = VALUE_RANGE - 1;
+
+	while (0 == counts[value])
+	{
+		--value;
+	}
+
+	return value;
+}
+
+/* bigger is first, so "max" really is the biggest value */
+static int CompareBigger(const void *data1, const void *data2)
+{
+	return *(const int *)data1 - *(const int *)data2;
+}
@@ -0,0 +1,478 @@
+/*
+   Code by: Or Yamin
+   Project: concurrent priority queue (MultiQueue over sharded heaps)
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* Same API and ordering as heap_pq, safe to call from many threads. The
+   elements are spread over several heaps ("shards"), each with its own lock.
+   Enqueue pushes into a random shard; dequeue locks two random shards and
+   pops the better of their two tops. Threads rarely want the same shard, so
+   throughput grows with the thread count, but a dequeue may return an
+   element that is slightly worse than the global best.
+
+   In strict mode dequeue locks every shard and takes the best top overall,
+   which gives exact heap_pq order at the cost of serializing dequeues. */
+
+#include <stdlib.h> /* size_t malloc() posix_memalign() free() */
+#include <assert.h> /* assert() */
+#include <pthread.h> /* pthread_mutex_t */
+#include <unistd.h> /* sysconf() */
+
+#include "heap.h"
+#include "mq_pq.h"
+
+#define CACHE_LINE 64
+#define SHARDS_PER_CPU 2
+#define MIN_SHARDS 2
+#define MAX_TRIES 16 /* busy picks before a call stops skipping them */
+
+/* one shard per cache line, so threads on different shards never share one.
+   count mirrors the heap's size: it is written under the lock and read
+   without it, so the queue's size needs no shared counter */
+struct mq_shard
+{
+	pthread_mutex_t lock;
+	heap_t *heap;
+	size_t count;
+	char pad[CACHE_LINE - (sizeof(pthread_mutex_t) + sizeof(heap_t *) +
+											sizeof(size_t)) % CACHE_LINE];
+};
+
+struct mq_pq
+{
+	struct mq_shard *shards;
+	size_t num_shards;
+	mq_pq_compare_func_t cmp_func;
+	int is_strict;
+};
+
+/* per thread, so picking a shard never touches shared memory */
+static __thread unsigned long rng_state = 0;
+
+static size_t RandomShard(const mq_pq_t *queue);
+static void *PopBetter(mq_pq_t *queue, struct mq_shard *first,
+												struct mq_shard *second);
+static void *DequeueStrict(mq_pq_t *queue);
+static void *DequeueSweep(mq_pq_t *queue);
+static void *PopShard(struct mq_shard *shard);
+static void PublishCount(struct mq_shard *shard);
+static void DestroyShards(struct mq_shard *shards, size_t count);
+
+
+/* num_shards 0 picks a default from the number of online CPUs */
+mq_pq_t *MQ_PQCreate(mq_pq_compare_func_t cmp_func, size_t num_shards,
+																int is_strict)
+{
+	mq_pq_t *queue = NULL;
+	void *shards = NULL;
+	long num_cpus = 0;
+	size_t i = 0;
+
+	assert(NULL != cmp_func);
+
+	if (0 == num_shards)
+	{
+		num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		num_shards = (0 < num_cpus) ? (size_t)num_cpus * SHARDS_PER_CPU : 0;
+	}
+	if (num_shards < MIN_SHARDS)
+	{
+		num_shards = MIN_SHARDS;
+	}
+
+	queue = (mq_pq_t *)malloc(sizeof(mq_pq_t));
+	if (NULL == queue)
+	{
+		return NULL;
+	}
+
+	/* malloc only promises 16 bytes; the padding is worthless unless every
+	   shard also starts on a line */
+	if (0 != posix_memalign(&shards, CACHE_LINE,
+									num_shards * sizeof(struct mq_shard)))
+	{
+		free(queue);
+		return NULL;
+	}
+	queue->shards = (struct mq_shard *)shards;
+
+	for (i = 0; i < num_shards; ++i)
+	{
+		queue->shards[i].count = 0;
+		queue->shards[i].heap = HeapCreate(cmp_func);
+		if (NULL == queue->shards[i].heap)
+		{
+			break;
+		}
+
+		if (0 != pthread_mutex_init(&queue->shards[i].lock, NULL))
+		{
+			HeapDestroy(queue->shards[i].heap);
+			break;
+		}
+	}
+
+	if (i < num_shards)
+	{
+		DestroyShards(queue->shards, i);
+		free(queue);
+		return NULL;
+	}
+
+	queue->num_shards = num_shards;
+	queue->cmp_func = cmp_func;
+	queue->is_strict = is_strict;
+
+	return queue;
+}
+
+
+
+/* must not race with any other call on the same queue */
+void MQ_PQDestroy(mq_pq_t *queue)
+{
+	assert(NULL != queue);
+
+	DestroyShards(queue->shards, queue->num_shards);
+	free(queue);
+}
+
+
+
+int MQ_PQEnqueue(mq_pq_t *queue, void *data)
+{
+	struct mq_shard *shard = NULL;
+	size_t tries = 0;
+	int status = 0;
+
+	assert(NULL != queue);
+	assert(NULL != data);
+
+	/* a busy shard is skipped rather than waited on, until every pick was
+	   busy - e.g. while a strict dequeue or a peek holds all of them */
+	do
+	{
+		shard = &queue->shards[RandomShard(queue)];
+		if (MAX_TRIES == ++tries)
+		{
+			pthread_mutex_lock(&shard->lock);
+			break;
+		}
+	}
+	while (0 != pthread_mutex_trylock(&shard->lock));
+
+	status = HeapPush(shard->heap, data);
+	PublishCount(shard);
+	pthread_mutex_unlock(&shard->lock);
+
+	return status;
+}
+
+
+
+/* returns NULL only when every shard was seen empty */
+void *MQ_PQDequeue(mq_pq_t *queue)
+{
+	size_t first = 0;
+	size_t second = 0;
+	size_t tries = 0;
+	size_t temp = 0;
+	void *data = NULL;
+
+	assert(NULL != queue);
+
+	if (queue->is_strict)
+	{
+		return DequeueStrict(queue);
+	}
+
+	for (tries = 0; tries < MAX_TRIES; ++tries)
+	{
+		first = RandomShard(queue);
+		do
+		{
+			second = RandomShard(queue);
+		}
+		while (second == first);
+
+		/* both locks are needed to compare the two tops safely; lock in index
+		   order and give up on this pair if either is busy */
+		if (first > second)
+		{
+			temp = first;
+			first = second;
+			second = temp;
+		}
+
+		if (0 != pthread_mutex_trylock(&queue->shards[first].lock))
+		{
+			continue;
+		}
+		if (0 != pthread_mutex_trylock(&queue->shards[second].lock))
+		{
+			pthread_mutex_unlock(&queue->shards[first].lock);
+			continue;
+		}
+
+		data = PopBetter(queue, &queue->shards[first], &queue->shards[second]);
+
+		pthread_mutex_unlock(&queue->shards[second].lock);
+		pthread_mutex_unlock(&queue->shards[first].lock);
+
+		if (NULL != data)
+		{
+			return data;
+		}
+	}
+
+	/* contended or nearly empty - take whatever any shard has */
+	return DequeueSweep(queue);
+}
+
+
+
+/* the best element over all shards at the moment of the call; it may be
+   dequeued by another thread as soon as this returns */
+void *MQ_PQPeek(mq_pq_t *queue)
+{
+	void *best = NULL;
+	void *top = NULL;
+	size_t i = 0;
+
+	assert(NULL != queue);
+
+	for (i = 0; i < queue->num_shards; ++i)
+	{
+		pthread_mutex_lock(&queue->shards[i].lock);
+	}
+
+	for (i = 0; i < queue->num_shards; ++i)
+	{
+		if (!HeapIsEmpty(queue->shards[i].heap))
+		{
+			top = HeapPeek(queue->shards[i].heap);
+			if (NULL == best || 0 < queue->cmp_func(top, best))
+			{
+				best = top;
+			}
+		}
+	}
+
+	for (i = queue->num_shards; 0 < i; --i)
+	{
+		pthread_mutex_unlock(&queue->shards[i - 1].lock);
+	}
+
+	return best;
+}
+
+
+
+int MQ_PQIsEmpty(const mq_pq_t *queue)
+{
+	assert(NULL != queue);
+	return (0 == MQ_PQSize(queue));
+}
+
+
+
+/* the sum of the shard counts; exact when no other thread is inside the
+   queue. Reads every shard's line, so it is not meant for hot loops */
+size_t MQ_PQSize(const mq_pq_t *queue)
+{
+	size_t size = 0;
+	size_t i = 0;
+
+	assert(NULL != queue);
+
+	for (i = 0; i < queue->num_shards; ++i)
+	{
+		size += __atomic_load_n(&queue->shards[i].count, __ATOMIC_RELAXED);
+	}
+
+	return size;
+}
+
+
+
+void MQ_PQClear(mq_pq_t *queue)
+{
+	struct mq_shard *shard = NULL;
+	size_t i = 0;
+
+	assert(NULL != queue);
+
+	for (i = 0; i < queue->num_shards; ++i)
+	{
+		shard = &queue->shards[i];
+
+		pthread_mutex_lock(&shard->lock);
+		while (!HeapIsEmpty(shard->heap))
+		{
+			HeapPop(shard->heap);
+		}
+		PublishCount(shard);
+		pthread_mutex_unlock(&shard->lock);
+	}
+}
+
+
+
+void *MQ_PQErase(mq_pq_t *queue, mq_pq_match_func_t is_match, void *param)
+{
+	struct mq_shard *shard = NULL;
+	void *data = NULL;
+	size_t i = 0;
+
+	assert(NULL != queue);
+	assert(NULL != is_match);
+
+	for (i = 0; i < queue->num_shards && NULL == data; ++i)
+	{
+		shard = &queue->shards[i];
+
+		pthread_mutex_lock(&shard->lock);
+		data = HeapRemove(shard->heap, is_match, param);
+		PublishCount(shard);
+		pthread_mutex_unlock(&shard->lock);
+	}
+
+	return data;
+}
+
+
+/**************************************** Helpers *****************************/
+/* xorshift64, seeded from the address of the thread's own state */
+static size_t RandomShard(const mq_pq_t *queue)
+{
+	if (0 == rng_state)
+	{
+		rng_state = (unsigned long)&rng_state | 1;
+	}
+
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 7;
+	rng_state ^= rng_state << 17;
+
+	return (size_t)(rng_state % queue->num_shards);
+}
+
+/* both shards are locked by the caller */
+static void *PopBetter(mq_pq_t *queue, struct mq_shard *first,
+												struct mq_shard *second)
+{
+	struct mq_shard *chosen = NULL;
+
+	if (HeapIsEmpty(first->heap))
+	{
+		chosen = second;
+	}
+	else if (HeapIsEmpty(second->heap))
+	{
+		chosen = first;
+	}
+	else
+	{
+		chosen = (queue->cmp_func(HeapPeek(first->heap),
+						HeapPeek(second->heap)) >= 0) ? first : second;
+	}
+
+	if (HeapIsEmpty(chosen->heap))
+	{
+		return NULL;
+	}
+
+	return PopShard(chosen);
+}
+
+static void *DequeueStrict(mq_pq_t *queue)
+{
+	struct mq_shard *best = NULL;
+	void *data = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < queue->num_shards; ++i)
+	{
+		pthread_mutex_lock(&queue->shards[i].lock);
+	}
+
+	for (i = 0; i < queue->num_shards; ++i)
+	{
+		if (!HeapIsEmpty(queue->shards[i].heap) && (NULL == best ||
+				0 < queue->cmp_func(HeapPeek(queue->shards[i].heap),
+											HeapPeek(best->heap))))
+		{
+			best = &queue->shards[i];
+		}
+	}
+
+	if (NULL != best)
+	{
+		data = PopShard(best);
+	}
+
+	for (i = queue->num_shards; 0 < i; --i)
+	{
+		pthread_mutex_unlock(&queue->shards[i - 1].lock);
+	}
+
+	return data;
+}
+
+/* visits the shards one at a time and pops from the first non-empty one */
+static void *DequeueSweep(mq_pq_t *queue)
+{
+	struct mq_shard *shard = NULL;
+	void *data = NULL;
+	size_t start = RandomShard(queue);
+	size_t i = 0;
+
+	for (i = 0; i < queue->num_shards && NULL == data; ++i)
+	{
+		shard = &queue->shards[(start + i) % queue->num_shards];
+
+		pthread_mutex_lock(&shard->lock);
+		if (!HeapIsEmpty(shard->heap))
+		{
+			data = PopShard(shard);
+		}
+		pthread_mutex_unlock(&shard->lock);
+	}
+
+	return data;
+}
+
+/* the shard is locked by the caller and not empty */
+static void *PopShard(struct mq_shard *shard)
+{
+	void *data = HeapPeek(shard->heap);
+
+	HeapPop(shard->heap);
+	PublishCount(shard);
+
+	return data;
+}
+
+/* called with the shard locked after every change to its heap */
+static void PublishCount(struct mq_shard *shard)
+{
+	__atomic_store_n(&shard->count, HeapSize(shard->heap), __ATOMIC_RELAXED);
+}
+
+static void DestroyShards(struct mq_shard *shards, size_t count)
+{
+	size_t i = 0;
+
+	for (i = 0; i < count; ++i)
+	{
+		pthread_mutex_destroy(&shards[i].lock);
+		HeapDestroy(shards[i].heap);
+	}
+
+	free(shards);
+}
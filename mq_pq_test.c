@@ -0,0 +1,271 @@
+/*
+   Code by: Or Yamin
+   Project: concurrent priority queue (MultiQueue) - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stdlib.h> /* rand() srand() */
+#include <pthread.h> /* pthread_create() pthread_join() */
+
+#include "mq_pq.h"
+
+#define SHARDS 4
+#define ITEMS 2000
+#define PRODUCERS 4
+#define CONSUMERS 4
+#define ITEMS_PER_PRODUCER 5000
+#define TOTAL_ITEMS (PRODUCERS * ITEMS_PER_PRODUCER)
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+struct worker_arg
+{
+	mq_pq_t *queue;
+	int first_item;
+	int taken;
+};
+
+static int failures = 0;
+static int items[TOTAL_ITEMS];
+static int seen[TOTAL_ITEMS];
+static int consumed = 0;
+
+static void TestStrictOrder(void);
+static void TestRelaxed(void);
+static void TestEraseClear(void);
+static void TestConcurrent(int is_strict);
+static void *Produce(void *arg);
+static void *Consume(void *arg);
+static int CompareSmaller(const void *data1, const void *data2);
+static int IsValue(const void *data, const void *param);
+
+
+int main(void)
+{
+	size_t i = 0;
+
+	srand(5);
+	for (i = 0; i < TOTAL_ITEMS; ++i)
+	{
+		items[i] = rand() % 1000;
+	}
+
+	TestStrictOrder();
+	TestRelaxed();
+	TestEraseClear();
+	TestConcurrent(0);
+	TestConcurrent(1);
+
+	if (0 == failures)
+	{
+		puts("mq_pq: all tests passed");
+	}
+
+	return failures;
+}
+
+
+/* strict mode gives exact heap_pq order */
+static void TestStrictOrder(void)
+{
+	mq_pq_t *queue = MQ_PQCreate(CompareSmaller, SHARDS, 1);
+	int *data = NULL;
+	int last = -1;
+	size_t i = 0;
+
+	CHECK(NULL != queue);
+	CHECK(MQ_PQIsEmpty(queue));
+	CHECK(NULL == MQ_PQDequeue(queue));
+	CHECK(NULL == MQ_PQPeek(queue));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		CHECK(0 == MQ_PQEnqueue(queue, &items[i]));
+	}
+	CHECK(ITEMS == MQ_PQSize(queue));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		data = (int *)MQ_PQPeek(queue);
+		CHECK(data == MQ_PQDequeue(queue));
+		CHECK(last <= *data);
+		last = *data;
+	}
+	CHECK(MQ_PQIsEmpty(queue));
+
+	MQ_PQDestroy(queue);
+}
+
+/* relaxed mode may reorder a little, but loses nothing and only returns
+   NULL when the queue is empty */
+static void TestRelaxed(void)
+{
+	mq_pq_t *queue = MQ_PQCreate(CompareSmaller, 0, 0);
+	int taken[ITEMS] = {0};
+	int *data = NULL;
+	int best = 1000;
+	size_t i = 0;
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		MQ_PQEnqueue(queue, &items[i]);
+		best = (items[i] < best) ? items[i] : best;
+	}
+
+	/* Peek looks at every shard */
+	CHECK(best == *(int *)MQ_PQPeek(queue));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		data = (int *)MQ_PQDequeue(queue);
+		CHECK(NULL != data);
+		if (NULL != data)
+		{
+			++taken[data - items];
+		}
+		CHECK(ITEMS - i - 1 == MQ_PQSize(queue));
+	}
+	CHECK(NULL == MQ_PQDequeue(queue));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		CHECK(1 == taken[i]);
+	}
+
+	MQ_PQDestroy(queue);
+}
+
+static void TestEraseClear(void)
+{
+	mq_pq_t *queue = MQ_PQCreate(CompareSmaller, SHARDS, 0);
+	int values[] = {5, 3, 8, 1};
+	int missing = 7;
+	size_t i = 0;
+
+	for (i = 0; i < 4; ++i)
+	{
+		MQ_PQEnqueue(queue, &values[i]);
+	}
+
+	CHECK(&values[2] == MQ_PQErase(queue, IsValue, &values[2]));
+	CHECK(NULL == MQ_PQErase(queue, IsValue, &missing));
+	CHECK(3 == MQ_PQSize(queue));
+
+	MQ_PQClear(queue);
+	CHECK(MQ_PQIsEmpty(queue));
+	CHECK(NULL == MQ_PQDequeue(queue));
+
+	MQ_PQDestroy(queue);
+}
+
+/* producers and consumers run at once; every item comes out exactly once */
+static void TestConcurrent(int is_strict)
+{
+	mq_pq_t *queue = MQ_PQCreate(CompareSmaller, 0, is_strict);
+	pthread_t producers[PRODUCERS];
+	pthread_t consumers[CONSUMERS];
+	struct worker_arg producer_args[PRODUCERS];
+	struct worker_arg consumer_args[CONSUMERS];
+	int taken = 0;
+	int i = 0;
+
+	consumed = 0;
+	for (i = 0; i < TOTAL_ITEMS; ++i)
+	{
+		seen[i] = 0;
+	}
+
+	for (i = 0; i < PRODUCERS; ++i)
+	{
+		producer_args[i].queue = queue;
+		producer_args[i].first_item = i * ITEMS_PER_PRODUCER;
+		pthread_create(&producers[i], NULL, Produce, &producer_args[i]);
+	}
+	for (i = 0; i < CONSUMERS; ++i)
+	{
+		consumer_args[i].queue = queue;
+		consumer_args[i].taken = 0;
+		pthread_create(&consumers[i], NULL, Consume, &consumer_args[i]);
+	}
+
+	for (i = 0; i < PRODUCERS; ++i)
+	{
+		pthread_join(producers[i], NULL);
+	}
+	for (i = 0; i < CONSUMERS; ++i)
+	{
+		pthread_join(consumers[i], NULL);
+		taken += consumer_args[i].taken;
+	}
+
+	CHECK(TOTAL_ITEMS == taken);
+	for (i = 0; i < TOTAL_ITEMS; ++i)
+	{
+		CHECK(1 == seen[i]);
+	}
+	CHECK(MQ_PQIsEmpty(queue));
+
+	MQ_PQDestroy(queue);
+}
+
+static void *Produce(void *arg)
+{
+	struct worker_arg *producer = (struct worker_arg *)arg;
+	int i = 0;
+
+	for (i = 0; i < ITEMS_PER_PRODUCER; ++i)
+	{
+		while (0 != MQ_PQEnqueue(producer->queue,
+									&items[producer->first_item + i]))
+		{
+		}
+	}
+
+	return NULL;
+}
+
+static void *Consume(void *arg)
+{
+	struct worker_arg *consumer = (struct worker_arg *)arg;
+	int *data = NULL;
+
+	while (TOTAL_ITEMS > __atomic_load_n(&consumed, __ATOMIC_RELAXED))
+	{
+		data = (int *)MQ_PQDequeue(consumer->queue);
+		if (NULL == data)
+		{
+			continue;
+		}
+
+		++seen[data - items];
+		++consumer->taken;
+		__atomic_fetch_add(&consumed, 1, __ATOMIC_RELAXED);
+	}
+
+	return NULL;
+}
+
+/* the smallest value is the best, as in a min-heap */
+static int CompareSmaller(const void *data1, const void *data2)
+{
+	return *(const int *)data2 - *(const int *)data1;
+}
+
+static int IsValue(const void *data, const void *param)
+{
+	return (*(const int *)data == *(const int *)param);
+}
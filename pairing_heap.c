@@ -0,0 +1,382 @@
+/*
+   Code by: Or Yamin
+   Project: pairing heap (meldable priority queue)
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* Same ordering as heap.c: cmp(a, b) > 0 puts a above b. The heap is a
+   tree in which every node keeps its children in a list; push and merge
+   just link two roots, and pop pairs up the root's children in two passes.
+   Push and merge are O(1), pop and decrease-key amortized O(log n).
+
+   Nodes come from a pool_t when one is given, otherwise from malloc. Two
+   heaps can only be merged when their nodes come from the same place. */
+
+#include <stdlib.h> /* size_t malloc() free() */
+#include <assert.h> /* assert() */
+
+#include "pool.h"
+#include "pairing_heap.h"
+
+/* prev is the parent for a first child and the left sibling otherwise */
+struct pairing_heap_node
+{
+	void *data;
+	struct pairing_heap_node *child;
+	struct pairing_heap_node *next;
+	struct pairing_heap_node *prev;
+};
+
+struct pairing_heap
+{
+	struct pairing_heap_node *root;
+	pairing_heap_compare_func_t cmp_func;
+	pool_t *pool;
+	size_t size;
+};
+
+static pairing_heap_node_t *Link(pairing_heap_t *heap,
+						pairing_heap_node_t *first, pairing_heap_node_t *second);
+static pairing_heap_node_t *MergePairs(pairing_heap_t *heap,
+												pairing_heap_node_t *first);
+static void Cut(pairing_heap_node_t *node);
+static pairing_heap_node_t *AllocNode(pairing_heap_t *heap);
+static void FreeNode(pairing_heap_t *heap, pairing_heap_node_t *node);
+
+
+/* pool may be NULL; a pool is shared, so it is not destroyed with the heap */
+pairing_heap_t *PairingHeapCreate(pairing_heap_compare_func_t cmp_func,
+																pool_t *pool)
+{
+	pairing_heap_t *heap = NULL;
+
+	assert(NULL != cmp_func);
+	assert(NULL == pool ||
+			PoolBlockSize(pool) >= sizeof(struct pairing_heap_node));
+
+	heap = (pairing_heap_t *)malloc(sizeof(pairing_heap_t));
+	if (NULL == heap)
+	{
+		return NULL;
+	}
+
+	heap->root = NULL;
+	heap->cmp_func = cmp_func;
+	heap->pool = pool;
+	heap->size = 0;
+
+	return heap;
+}
+
+
+
+void PairingHeapDestroy(pairing_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	PairingHeapClear(heap);
+	free(heap);
+}
+
+
+
+/* the returned node is the handle for DecreaseKey and Remove; it is valid
+   until its element leaves the heap. Returns NULL if allocation failed */
+pairing_heap_node_t *PairingHeapPush(pairing_heap_t *heap, void *data)
+{
+	pairing_heap_node_t *node = NULL;
+
+	assert(NULL != heap);
+
+	node = AllocNode(heap);
+	if (NULL == node)
+	{
+		return NULL;
+	}
+
+	/* a pooled node's first word can still be read as a free-list link by
+	   a PoolAlloc on another thread that lost the race for it */
+	__atomic_store_n(&node->data, data, __ATOMIC_RELAXED);
+	node->child = NULL;
+	node->next = NULL;
+	node->prev = NULL;
+
+	heap->root = Link(heap, heap->root, node);
+	++heap->size;
+
+	return node;
+}
+
+
+
+void *PairingHeapPop(pairing_heap_t *heap)
+{
+	pairing_heap_node_t *root = NULL;
+	void *data = NULL;
+
+	assert(NULL != heap);
+	assert(NULL != heap->root);
+
+	root = heap->root;
+	data = root->data;
+
+	heap->root = MergePairs(heap, root->child);
+	FreeNode(heap, root);
+	--heap->size;
+
+	return data;
+}
+
+
+
+void *PairingHeapPeek(const pairing_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(NULL != heap->root);
+
+	return heap->root->data;
+}
+
+
+
+/* moves every element of src into dest in O(1); src is left empty */
+void PairingHeapMerge(pairing_heap_t *dest, pairing_heap_t *src)
+{
+	assert(NULL != dest);
+	assert(NULL != src);
+	assert(dest->cmp_func == src->cmp_func);
+	assert(dest->pool == src->pool);
+
+	dest->root = Link(dest, dest->root, src->root);
+	dest->size += src->size;
+
+	src->root = NULL;
+	src->size = 0;
+}
+
+
+
+/* call after the priority of node's element was raised in place */
+void PairingHeapDecreaseKey(pairing_heap_t *heap, pairing_heap_node_t *node)
+{
+	assert(NULL != heap);
+	assert(NULL != node);
+
+	if (node == heap->root)
+	{
+		return;
+	}
+
+	Cut(node);
+	heap->root = Link(heap, heap->root, node);
+}
+
+
+
+void *PairingHeapRemove(pairing_heap_t *heap, pairing_heap_node_t *node)
+{
+	void *data = NULL;
+
+	assert(NULL != heap);
+	assert(NULL != node);
+
+	if (node == heap->root)
+	{
+		return PairingHeapPop(heap);
+	}
+
+	data = node->data;
+
+	Cut(node);
+	heap->root = Link(heap, heap->root, MergePairs(heap, node->child));
+	FreeNode(heap, node);
+	--heap->size;
+
+	return data;
+}
+
+
+
+void *PairingHeapGetData(const pairing_heap_node_t *node)
+{
+	assert(NULL != node);
+	return node->data;
+}
+
+
+
+size_t PairingHeapSize(const pairing_heap_t *heap)
+{
+	assert(NULL != heap);
+	return heap->size;
+}
+
+
+
+int PairingHeapIsEmpty(const pairing_heap_t *heap)
+{
+	assert(NULL != heap);
+	return (NULL == heap->root);
+}
+
+
+
+void PairingHeapClear(pairing_heap_t *heap)
+{
+	pairing_heap_node_t *node = NULL;
+	pairing_heap_node_t *child = NULL;
+	pairing_heap_node_t *next = NULL;
+
+	assert(NULL != heap);
+
+	/* walks the tree without recursion: a node's first child is taken off its
+	   list and made to point back at it, so once the child's subtree is gone
+	   the walk returns to the node */
+	node = heap->root;
+	while (NULL != node)
+	{
+		if (NULL != node->child)
+		{
+			child = node->child;
+			node->child = child->next;
+			child->next = node;
+			node = child;
+		}
+		else
+		{
+			next = node->next;
+			FreeNode(heap, node);
+			node = next;
+		}
+	}
+
+	heap->root = NULL;
+	heap->size = 0;
+}
+
+
+/**************************************** Helpers *****************************/
+/* makes the lower of two roots the first child of the higher one */
+static pairing_heap_node_t *Link(pairing_heap_t *heap,
+						pairing_heap_node_t *first, pairing_heap_node_t *second)
+{
+	pairing_heap_node_t *temp = NULL;
+
+	if (NULL == first)
+	{
+		return second;
+	}
+	if (NULL == second)
+	{
+		return first;
+	}
+
+	if (heap->cmp_func(second->data, first->data) > 0)
+	{
+		temp = first;
+		first = second;
+		second = temp;
+	}
+
+	second->next = first->child;
+	if (NULL != first->child)
+	{
+		first->child->prev = second;
+	}
+	second->prev = first;
+	first->child = second;
+
+	first->next = NULL;
+	first->prev = NULL;
+
+	return first;
+}
+
+/* the two-pass merge that gives pop its amortized bound: link the siblings
+   in pairs from left to right, then fold the pairs from right to left */
+static pairing_heap_node_t *MergePairs(pairing_heap_t *heap,
+												pairing_heap_node_t *first)
+{
+	pairing_heap_node_t *pairs = NULL;
+	pairing_heap_node_t *second = NULL;
+	pairing_heap_node_t *rest = NULL;
+	pairing_heap_node_t *linked = NULL;
+	pairing_heap_node_t *result = NULL;
+
+	/* first pass: the linked pairs are kept in a stack through next */
+	while (NULL != first)
+	{
+		second = first->next;
+		rest = (NULL != second) ? second->next : NULL;
+
+		first->next = NULL;
+		if (NULL != second)
+		{
+			second->next = NULL;
+		}
+
+		linked = Link(heap, first, second);
+		linked->next = pairs;
+		pairs = linked;
+
+		first = rest;
+	}
+
+	/* second pass: the stack pops the pairs in right to left order */
+	while (NULL != pairs)
+	{
+		linked = pairs;
+		pairs = pairs->next;
+		linked->next = NULL;
+
+		result = Link(heap, result, linked);
+	}
+
+	return result;
+}
+
+/* detaches the subtree rooted at node from its parent's child list */
+static void Cut(pairing_heap_node_t *node)
+{
+	if (node->prev->child == node)
+	{
+		node->prev->child = node->next;
+	}
+	else
+	{
+		node->prev->next = node->next;
+	}
+
+	if (NULL != node->next)
+	{
+		node->next->prev = node->prev;
+	}
+
+	node->next = NULL;
+	node->prev = NULL;
+}
+
+static pairing_heap_node_t *AllocNode(pairing_heap_t *heap)
+{
+	if (NULL != heap->pool)
+	{
+		return (pairing_heap_node_t *)PoolAlloc(heap->pool);
+	}
+
+	return (pairing_heap_node_t *)malloc(sizeof(pairing_heap_node_t));
+}
+
+static void FreeNode(pairing_heap_t *heap, pairing_heap_node_t *node)
+{
+	if (NULL != heap->pool)
+	{
+		PoolFree(heap->pool, node);
+		return;
+	}
+
+	free(node);
+}
@@ -0,0 +1,263 @@
+/*
+   Code by: Or Yamin
+   Project: pairing heap (meldable priority queue) - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stdlib.h> /* rand() srand() */
+#include <pthread.h> /* pthread_create() pthread_join() */
+
+#include "pool.h"
+#include "pairing_heap.h"
+
+#define ITEMS 5000
+#define THREADS 4
+#define ITEMS_PER_THREAD 2000
+/* a node is four pointers: data, child, next and prev */
+#define NODE_SIZE (4 * sizeof(void *))
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+struct worker_arg
+{
+	pool_t *pool;
+	int *items;
+	int errors;
+};
+
+static int failures = 0;
+static int items[ITEMS];
+static int thread_items[THREADS][ITEMS_PER_THREAD];
+
+static void TestOrder(pool_t *pool);
+static void TestMerge(pool_t *pool);
+static void TestDecreaseKeyRemove(pool_t *pool);
+static void TestSharedPool(void);
+static void *Work(void *arg);
+static int IsDrainedInOrder(pairing_heap_t *heap, size_t count);
+static int CompareSmaller(const void *data1, const void *data2);
+
+
+int main(void)
+{
+	pool_t *pool = PoolCreate(NODE_SIZE, 64);
+	size_t i = 0;
+
+	srand(7);
+	for (i = 0; i < ITEMS; ++i)
+	{
+		items[i] = rand() % 1000;
+	}
+
+	/* once with malloc'd nodes and once with pooled ones */
+	TestOrder(NULL);
+	TestOrder(pool);
+	TestMerge(NULL);
+	TestMerge(pool);
+	TestDecreaseKeyRemove(NULL);
+	TestDecreaseKeyRemove(pool);
+	TestSharedPool();
+
+	PoolDestroy(pool);
+
+	if (0 == failures)
+	{
+		puts("pairing_heap: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestOrder(pool_t *pool)
+{
+	pairing_heap_t *heap = PairingHeapCreate(CompareSmaller, pool);
+	size_t i = 0;
+
+	CHECK(NULL != heap);
+	CHECK(PairingHeapIsEmpty(heap));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		CHECK(NULL != PairingHeapPush(heap, &items[i]));
+	}
+	CHECK(ITEMS == PairingHeapSize(heap));
+	CHECK(IsDrainedInOrder(heap, ITEMS));
+	CHECK(PairingHeapIsEmpty(heap));
+
+	/* Clear frees the nodes and leaves the heap usable */
+	for (i = 0; i < 100; ++i)
+	{
+		PairingHeapPush(heap, &items[i]);
+	}
+	PairingHeapClear(heap);
+	CHECK(PairingHeapIsEmpty(heap));
+	PairingHeapPush(heap, &items[0]);
+	CHECK(&items[0] == PairingHeapPeek(heap));
+
+	PairingHeapDestroy(heap);
+}
+
+static void TestMerge(pool_t *pool)
+{
+	pairing_heap_t *dest = PairingHeapCreate(CompareSmaller, pool);
+	pairing_heap_t *src = PairingHeapCreate(CompareSmaller, pool);
+	size_t i = 0;
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		PairingHeapPush((0 == i % 3) ? src : dest, &items[i]);
+	}
+
+	PairingHeapMerge(dest, src);
+	CHECK(PairingHeapIsEmpty(src));
+	CHECK(ITEMS == PairingHeapSize(dest));
+	CHECK(IsDrainedInOrder(dest, ITEMS));
+
+	/* merging an empty heap in, and into an empty heap */
+	PairingHeapPush(src, &items[0]);
+	PairingHeapMerge(src, dest);
+	PairingHeapMerge(dest, src);
+	CHECK(1 == PairingHeapSize(dest));
+	CHECK(&items[0] == PairingHeapPop(dest));
+
+	PairingHeapDestroy(dest);
+	PairingHeapDestroy(src);
+}
+
+/* DecreaseKey is called after the element's key was made better in place */
+static void TestDecreaseKeyRemove(pool_t *pool)
+{
+	pairing_heap_t *heap = PairingHeapCreate(CompareSmaller, pool);
+	pairing_heap_node_t *nodes[ITEMS];
+	int keys[ITEMS];
+	int *top = NULL;
+	size_t removed = 0;
+	size_t i = 0;
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		keys[i] = items[i];
+		nodes[i] = PairingHeapPush(heap, &keys[i]);
+	}
+	/* pop once, so the root has a real tree of children under it */
+	top = (int *)PairingHeapPop(heap);
+	nodes[top - keys] = PairingHeapPush(heap, top);
+
+	keys[ITEMS / 2] = -1;
+	PairingHeapDecreaseKey(heap, nodes[ITEMS / 2]);
+	CHECK(&keys[ITEMS / 2] == PairingHeapPeek(heap));
+	CHECK(&keys[ITEMS / 2] == PairingHeapGetData(nodes[ITEMS / 2]));
+
+	/* Remove hands back the data, whether the node is the root or not */
+	CHECK(&keys[ITEMS / 2] == PairingHeapRemove(heap, nodes[ITEMS / 2]));
+	for (i = 1; i < ITEMS; i += 2)
+	{
+		if (ITEMS / 2 != i)
+		{
+			CHECK(&keys[i] == PairingHeapRemove(heap, nodes[i]));
+			++removed;
+		}
+	}
+	CHECK(ITEMS - 1 - removed == PairingHeapSize(heap));
+	CHECK(IsDrainedInOrder(heap, ITEMS - 1 - removed));
+
+	PairingHeapDestroy(heap);
+}
+
+/* the heaps are single-threaded, but their nodes come from one pool that
+   every thread allocates from and frees to at once */
+static void TestSharedPool(void)
+{
+	pool_t *pool = PoolCreate(NODE_SIZE, 16);
+	pthread_t threads[THREADS];
+	struct worker_arg args[THREADS];
+	int i = 0;
+
+	for (i = 0; i < THREADS; ++i)
+	{
+		args[i].pool = pool;
+		args[i].items = thread_items[i];
+		args[i].errors = 0;
+		pthread_create(&threads[i], NULL, Work, &args[i]);
+	}
+	for (i = 0; i < THREADS; ++i)
+	{
+		pthread_join(threads[i], NULL);
+		CHECK(0 == args[i].errors);
+	}
+
+	PoolDestroy(pool);
+}
+
+static void *Work(void *arg)
+{
+	struct worker_arg *worker = (struct worker_arg *)arg;
+	pairing_heap_t *heap = PairingHeapCreate(CompareSmaller, worker->pool);
+	int round = 0;
+	int i = 0;
+
+	for (i = 0; i < ITEMS_PER_THREAD; ++i)
+	{
+		worker->items[i] = items[(i * 7) % ITEMS];
+	}
+
+	for (round = 0; round < 5; ++round)
+	{
+		for (i = 0; i < ITEMS_PER_THREAD; ++i)
+		{
+			if (NULL == PairingHeapPush(heap, &worker->items[i]))
+			{
+				++worker->errors;
+			}
+		}
+		if (!IsDrainedInOrder(heap, ITEMS_PER_THREAD))
+		{
+			++worker->errors;
+		}
+	}
+
+	PairingHeapDestroy(heap);
+
+	return NULL;
+}
+
+/* pops count elements, each no better than the one before */
+static int IsDrainedInOrder(pairing_heap_t *heap, size_t count)
+{
+	int *data = NULL;
+	int last = -1;
+	size_t i = 0;
+
+	for (i = 0; i < count; ++i)
+	{
+		data = (int *)PairingHeapPeek(heap);
+		if (NULL == data || data != PairingHeapPop(heap) || last > *data)
+		{
+			return 0;
+		}
+		last = *data;
+	}
+
+	return PairingHeapIsEmpty(heap);
+}
+
+/* the smallest value is the best, as in a min-heap */
+static int CompareSmaller(const void *data1, const void *data2)
+{
+	return *(const int *)data2 - *(const int *)data1;
+}
@@ -0,0 +1,378 @@
+/*
+   Code by: Or Yamin
+   Project: Fixed-size object pool allocator
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdlib.h> /* malloc free size_t */
+#include <assert.h> /* assert */
+#include <pthread.h> /* pthread_mutex_t */
+
+#include "lfstack.h"
+#include "pool.h"
+
+#define ALIGNMENT (2 * sizeof(void *)) /* what malloc gives: long double, SSE */
+#define ROUND_UP(x) (((x) + ALIGNMENT - 1) & ~(ALIGNMENT - 1))
+#define CACHE_MAX_BLOCKS 64
+#define CACHE_REFILL_BLOCKS (CACHE_MAX_BLOCKS / 2)
+
+/* blocks follow the header, whose pad makes it 2 words long; with
+   block_size rounded to ALIGNMENT every block keeps malloc's alignment */
+struct pool_slab
+{
+	struct pool_slab *next;
+	size_t pad;
+};
+
+struct pool
+{
+	lfstack_t *free_blocks;
+	size_t block_size;
+	size_t blocks_per_slab;
+	struct pool_slab *slabs;
+	struct pool_slab *current;
+	size_t next_block;
+	size_t generation;
+	pthread_mutex_t carve_lock;
+};
+
+/* a cache is owned by a single thread; its blocks are chained through their
+   first word exactly like the shared free-list */
+struct pool_cache
+{
+	pool_t *pool;
+	void *blocks;
+	size_t count;
+	size_t generation;
+};
+
+static size_t Carve(pool_t *pool, size_t count, void **first, void **last);
+static char *SlabBlock(const pool_t *pool, struct pool_slab *slab, size_t index);
+static void SyncGeneration(pool_cache_t *cache);
+static void SetLink(void *block, void *next);
+
+
+pool_t *PoolCreate(size_t block_size, size_t blocks_per_slab)
+{
+	pool_t *pool = NULL;
+
+	assert(0 < block_size);
+	assert(0 < blocks_per_slab);
+
+	pool = (pool_t *)malloc(sizeof(pool_t));
+	if (NULL == pool)
+	{
+		return NULL;
+	}
+
+	pool->free_blocks = LFStackCreate();
+	if (NULL == pool->free_blocks)
+	{
+		free(pool);
+		return NULL;
+	}
+
+	if (0 != pthread_mutex_init(&pool->carve_lock, NULL))
+	{
+		LFStackDestroy(pool->free_blocks);
+		free(pool);
+		return NULL;
+	}
+
+	if (block_size < sizeof(void *))
+	{
+		block_size = sizeof(void *);
+	}
+
+	pool->block_size = ROUND_UP(block_size);
+	pool->blocks_per_slab = blocks_per_slab;
+	pool->slabs = NULL;
+	pool->current = NULL;
+	pool->next_block = 0;
+	pool->generation = 0;
+
+	return pool;
+}
+
+
+
+void PoolDestroy(pool_t *pool)
+{
+	struct pool_slab *slab = NULL;
+	struct pool_slab *next = NULL;
+
+	assert(NULL != pool);
+
+	for (slab = pool->slabs; NULL != slab; slab = next)
+	{
+		next = slab->next;
+		free(slab);
+	}
+
+	pthread_mutex_destroy(&pool->carve_lock);
+	LFStackDestroy(pool->free_blocks);
+	free(pool);
+}
+
+
+
+/* a PoolAlloc that loses the race for a block may still read the block's
+   first word after the winner got it, so a pool shared between threads
+   needs that word written atomically, as SetLink does */
+void *PoolAlloc(pool_t *pool)
+{
+	void *block = NULL;
+	void *last = NULL;
+
+	assert(NULL != pool);
+
+	block = LFStackPop(pool->free_blocks);
+	if (NULL == block)
+	{
+		Carve(pool, 1, &block, &last);
+	}
+
+	return block;
+}
+
+
+
+void PoolFree(pool_t *pool, void *block)
+{
+	assert(NULL != pool);
+	assert(NULL != block);
+
+	LFStackPush(pool->free_blocks, block);
+}
+
+
+
+void PoolReset(pool_t *pool)
+{
+	assert(NULL != pool);
+
+	/* every block handed out so far becomes invalid at once; must not race
+	   with PoolAlloc or PoolFree. Slabs are kept and carved again from the
+	   start, so a pool that is reset every round stops calling malloc */
+	pthread_mutex_lock(&pool->carve_lock);
+	LFStackPopAll(pool->free_blocks);
+	pool->current = pool->slabs;
+	pool->next_block = 0;
+	__atomic_add_fetch(&pool->generation, 1, __ATOMIC_RELEASE);
+	pthread_mutex_unlock(&pool->carve_lock);
+}
+
+
+
+size_t PoolBlockSize(const pool_t *pool)
+{
+	assert(NULL != pool);
+	return pool->block_size;
+}
+
+
+
+pool_cache_t *PoolCacheCreate(pool_t *pool)
+{
+	pool_cache_t *cache = NULL;
+
+	assert(NULL != pool);
+
+	cache = (pool_cache_t *)malloc(sizeof(pool_cache_t));
+	if (NULL == cache)
+	{
+		return NULL;
+	}
+
+	cache->pool = pool;
+	cache->blocks = NULL;
+	cache->count = 0;
+	cache->generation = __atomic_load_n(&pool->generation, __ATOMIC_ACQUIRE);
+
+	return cache;
+}
+
+
+
+void PoolCacheDestroy(pool_cache_t *cache)
+{
+	void *last = NULL;
+
+	assert(NULL != cache);
+
+	SyncGeneration(cache);
+
+	if (NULL != cache->blocks)
+	{
+		for (last = cache->blocks; NULL != LFStackNext(last); )
+		{
+			last = LFStackNext(last);
+		}
+		LFStackPushChain(cache->pool->free_blocks, cache->blocks, last);
+	}
+
+	free(cache);
+}
+
+
+
+void *PoolCacheAlloc(pool_cache_t *cache)
+{
+	void *block = NULL;
+	void *last = NULL;
+
+	assert(NULL != cache);
+
+	SyncGeneration(cache);
+
+	if (NULL == cache->blocks)
+	{
+		while (cache->count < CACHE_REFILL_BLOCKS &&
+				NULL != (block = LFStackPop(cache->pool->free_blocks)))
+		{
+			SetLink(block, cache->blocks);
+			cache->blocks = block;
+			++cache->count;
+		}
+
+		if (NULL == cache->blocks)
+		{
+			cache->count = Carve(cache->pool, CACHE_REFILL_BLOCKS,
+													&cache->blocks, &last);
+			if (0 == cache->count)
+			{
+				return NULL;
+			}
+		}
+	}
+
+	block = cache->blocks;
+	cache->blocks = *(void **)block;
+	--cache->count;
+
+	return block;
+}
+
+
+
+void PoolCacheFree(pool_cache_t *cache, void *block)
+{
+	void *last = NULL;
+	size_t i = 0;
+
+	assert(NULL != cache);
+	assert(NULL != block);
+
+	SyncGeneration(cache);
+
+	SetLink(block, cache->blocks);
+	cache->blocks = block;
+	++cache->count;
+
+	/* hand half back so other threads can use it */
+	if (CACHE_MAX_BLOCKS < cache->count)
+	{
+		for (last = cache->blocks, i = 1; i < CACHE_REFILL_BLOCKS; ++i)
+		{
+			last = *(void **)last;
+		}
+
+		block = *(void **)last;
+		SetLink(last, NULL);
+		LFStackPushChain(cache->pool->free_blocks, cache->blocks, last);
+		cache->blocks = block;
+		cache->count -= CACHE_REFILL_BLOCKS;
+	}
+}
+
+
+/**************************************** Helpers *****************************/
+/* hands out up to count never-used blocks as a NULL terminated chain */
+static size_t Carve(pool_t *pool, size_t count, void **first, void **last)
+{
+	struct pool_slab *slab = NULL;
+	size_t carved = 0;
+	char *block = NULL;
+
+	*first = NULL;
+	*last = NULL;
+
+	pthread_mutex_lock(&pool->carve_lock);
+
+	while (carved < count)
+	{
+		if (NULL == pool->current || pool->next_block == pool->blocks_per_slab)
+		{
+			if (NULL != pool->current && NULL != pool->current->next)
+			{
+				pool->current = pool->current->next;
+			}
+			else
+			{
+				slab = (struct pool_slab *)malloc(sizeof(struct pool_slab) +
+								pool->blocks_per_slab * pool->block_size);
+				if (NULL == slab)
+				{
+					break;
+				}
+
+				slab->next = NULL;
+				if (NULL == pool->current)
+				{
+					pool->slabs = slab;
+				}
+				else
+				{
+					pool->current->next = slab;
+				}
+				pool->current = slab;
+			}
+			pool->next_block = 0;
+		}
+
+		block = SlabBlock(pool, pool->current, pool->next_block);
+		++pool->next_block;
+
+		SetLink(block, *first);
+		*first = block;
+		if (NULL == *last)
+		{
+			*last = block;
+		}
+		++carved;
+	}
+
+	pthread_mutex_unlock(&pool->carve_lock);
+
+	return carved;
+}
+
+static char *SlabBlock(const pool_t *pool, struct pool_slab *slab, size_t index)
+{
+	return (char *)slab + sizeof(struct pool_slab) + index * pool->block_size;
+}
+
+/* blocks held across a PoolReset belong to the old generation - drop them */
+static void SyncGeneration(pool_cache_t *cache)
+{
+	size_t generation = __atomic_load_n(&cache->pool->generation,
+															__ATOMIC_ACQUIRE);
+
+	if (generation != cache->generation)
+	{
+		cache->blocks = NULL;
+		cache->count = 0;
+		cache->generation = generation;
+	}
+}
+
+/* a block's first word may still be read as a link by a LFStackPop that
+   lost the race for it, so it is written atomically */
+static void SetLink(void *block, void *next)
+{
+	__atomic_store_n((void **)block, next, __ATOMIC_RELAXED);
+}
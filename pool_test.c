@@ -0,0 +1,216 @@
+/*
+   Code by: Or Yamin
+   Project: Fixed-size object pool allocator - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <string.h> /* memset() */
+#include <pthread.h> /* pthread_create() pthread_join() */
+
+#include "pool.h"
+
+#define BLOCK_SIZE 40
+#define BLOCKS_PER_SLAB 16
+#define THREADS 8
+#define ROUNDS 2000
+#define BATCH 100
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+static int failures = 0;
+
+static void TestAllocFree(void);
+static void TestReset(void);
+static void TestCache(void);
+static void TestConcurrent(void);
+static void *Churn(void *arg);
+static int IsAligned(const void *block);
+
+
+int main(void)
+{
+	TestAllocFree();
+	TestReset();
+	TestCache();
+	TestConcurrent();
+
+	if (0 == failures)
+	{
+		puts("pool: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestAllocFree(void)
+{
+	pool_t *pool = PoolCreate(BLOCK_SIZE, BLOCKS_PER_SLAB);
+	char *blocks[BLOCKS_PER_SLAB * 3];
+	size_t i = 0;
+	size_t j = 0;
+
+	CHECK(NULL != pool);
+	CHECK(BLOCK_SIZE <= PoolBlockSize(pool));
+
+	/* spans three slabs; the blocks must be distinct and not overlap */
+	for (i = 0; i < BLOCKS_PER_SLAB * 3; ++i)
+	{
+		blocks[i] = (char *)PoolAlloc(pool);
+		CHECK(NULL != blocks[i]);
+		CHECK(IsAligned(blocks[i]));
+		memset(blocks[i], (int)i, PoolBlockSize(pool));
+	}
+	for (i = 0; i < BLOCKS_PER_SLAB * 3; ++i)
+	{
+		for (j = 0; j < PoolBlockSize(pool); ++j)
+		{
+			CHECK((char)i == blocks[i][j]);
+		}
+	}
+
+	/* the free-list is a stack */
+	PoolFree(pool, blocks[5]);
+	PoolFree(pool, blocks[7]);
+	CHECK(blocks[7] == PoolAlloc(pool));
+	CHECK(blocks[5] == PoolAlloc(pool));
+
+	PoolDestroy(pool);
+}
+
+/* after a reset the same memory is handed out again from the start */
+static void TestReset(void)
+{
+	pool_t *pool = PoolCreate(BLOCK_SIZE, BLOCKS_PER_SLAB);
+	void *first = PoolAlloc(pool);
+	void *block = NULL;
+	size_t i = 0;
+
+	for (i = 1; i < BLOCKS_PER_SLAB * 2; ++i)
+	{
+		block = PoolAlloc(pool);
+	}
+	PoolFree(pool, block);
+
+	PoolReset(pool);
+	CHECK(first == PoolAlloc(pool));
+
+	PoolDestroy(pool);
+}
+
+static void TestCache(void)
+{
+	pool_t *pool = PoolCreate(BLOCK_SIZE, BLOCKS_PER_SLAB);
+	pool_cache_t *cache = PoolCacheCreate(pool);
+	void *blocks[200];
+	void *block = NULL;
+	size_t i = 0;
+
+	CHECK(NULL != cache);
+
+	for (i = 0; i < 200; ++i)
+	{
+		blocks[i] = PoolCacheAlloc(cache);
+		CHECK(NULL != blocks[i]);
+		CHECK(IsAligned(blocks[i]));
+		memset(blocks[i], 0, PoolBlockSize(pool));
+	}
+
+	/* the most recently freed block is handed out first */
+	PoolCacheFree(cache, blocks[0]);
+	CHECK(blocks[0] == PoolCacheAlloc(cache));
+
+	/* more frees than the cache keeps; the rest goes back to the pool */
+	for (i = 0; i < 200; ++i)
+	{
+		PoolCacheFree(cache, blocks[i]);
+	}
+	block = PoolAlloc(pool);
+	CHECK(NULL != block);
+	PoolFree(pool, block);
+
+	PoolCacheDestroy(cache);
+	PoolDestroy(pool);
+}
+
+/* each thread stamps the blocks it holds; a block handed to two threads at
+   once would show the other thread's stamp. The stamp goes in the second
+   word: a pop that lost the race for a block may still read its first */
+static void TestConcurrent(void)
+{
+	pool_t *pool = PoolCreate(BLOCK_SIZE, BLOCKS_PER_SLAB);
+	pthread_t threads[THREADS];
+	size_t i = 0;
+
+	for (i = 0; i < THREADS; ++i)
+	{
+		pthread_create(&threads[i], NULL, Churn, pool);
+	}
+	for (i = 0; i < THREADS; ++i)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	PoolDestroy(pool);
+}
+
+static void *Churn(void *arg)
+{
+	pool_t *pool = (pool_t *)arg;
+	pool_cache_t *cache = PoolCacheCreate(pool);
+	size_t *held[BATCH];
+	size_t stamp = (size_t)&held;
+	size_t i = 0;
+	size_t j = 0;
+
+	for (i = 0; i < ROUNDS; ++i)
+	{
+		for (j = 0; j < BATCH; ++j)
+		{
+			/* odd rounds skip the cache and use the shared free-list */
+			held[j] = (size_t *)((i & 1) ? PoolAlloc(pool) :
+														PoolCacheAlloc(cache));
+			held[j][1] = stamp;
+		}
+
+		for (j = 0; j < BATCH; ++j)
+		{
+			if (stamp != held[j][1])
+			{
+				__atomic_fetch_add(&failures, 1, __ATOMIC_RELAXED);
+			}
+
+			if (i & 1)
+			{
+				PoolFree(pool, held[j]);
+			}
+			else
+			{
+				PoolCacheFree(cache, held[j]);
+			}
+		}
+	}
+
+	PoolCacheDestroy(cache);
+
+	return NULL;
+}
+
+static int IsAligned(const void *block)
+{
+	return (0 == (size_t)block % (2 * sizeof(void *)));
+}
@@ -11,13 +11,13 @@
 #include <stdlib.h> /* size_t malloc() free() */
 #include <assert.h> /* assert() */
 
-#include "sortedlist.h"
+#include "skiplist.h"
 #include "pq.h"
 
 
 struct pq 
 {
-	sortedlist_t *sorted_list;
+	skiplist_t *sorted_list;
 };
 
 
@@ -34,7 +34,7 @@ pq_t *PQCreate(pq_compare_func_t cmp_func)
 		return NULL;
 	}
 	
-	pqueue->sorted_list = SortedlistCreate(cmp_func);
+	pqueue->sorted_list = SkiplistCreate(cmp_func);
 	if (pqueue->sorted_list == NULL) 
 	{
 		free(pqueue);
@@ -50,48 +50,76 @@ void PQDestroy(pq_t *queue)
 	assert(queue != NULL);
 	assert(queue->sorted_list != NULL);
     
-	SortedlistDestroy(queue->sorted_list);
+	SkiplistDestroy(queue->sorted_list);
 	free(queue);
 }
 
 
 int PQEnqueue(pq_t *queue, void *data) 
 {	
-	sortedlist_iter_t iter;
+	pq_handle_t handle;
 	
 	assert(queue != NULL);
 	assert(queue->sorted_list != NULL);
 	
-	iter = SortedlistInsert(queue->sorted_list, data);
+	return PQEnqueueHandle(queue, data, &handle);
+}
+
+
+
+/* handle stays valid until its element is dequeued or erased */
+int PQEnqueueHandle(pq_t *queue, void *data, pq_handle_t *handle) 
+{	
+	skiplist_iter_t iter;
+	
+	assert(queue != NULL);
+	assert(queue->sorted_list != NULL);
+	assert(handle != NULL);
+	
+	iter = SkiplistInsert(queue->sorted_list, data);
 	
-	if (SortedlistIsSameIter(iter, SortedlistGetEnd(queue->sorted_list))) 
+	if (SkiplistIsSameIter(iter, SkiplistGetEnd(queue->sorted_list))) 
 	{
 		return 1; 
     }
+    
+    *handle = iter;
 	return 0; 
 }
 
 
 
+/* the caller changes the priority inside the element, then calls this to
+   move it to its new place - O(log n) instead of erase and re-enqueue */
+void PQUpdate(pq_t *queue, pq_handle_t handle) 
+{
+	assert(queue != NULL);
+	assert(queue->sorted_list != NULL);
+	
+	SkiplistUpdate(handle);
+}
+
+
+
 void *PQDequeue(pq_t *queue) 
 {
     assert(queue != NULL);
     assert(queue->sorted_list != NULL);
     
-    return SortedlistPopFront(queue->sorted_list);
+    return SkiplistPopFront(queue->sorted_list);
 }
 
 
 
 void *PQPeek(const pq_t *queue) 
 {
-	sortedlist_iter_t iter;
+	skiplist_iter_t iter;
 	
     assert(queue != NULL);
     assert(queue->sorted_list != NULL);
     
-    iter = SortedlistGetBegin(queue->sorted_list);
-    return SortedlistGetData(iter);
+    iter = SkiplistGetBegin(queue->sorted_list);
+    return SkiplistGetData(iter);
 }
 
 
@@ -101,7 +129,7 @@ int PQIsEmpty(const pq_t *queue)
 	assert(queue != NULL);
 	assert(queue->sorted_list != NULL);
     
-	return SortedlistIsEmpty(queue->sorted_list);
+	return SkiplistIsEmpty(queue->sorted_list);
 }
 
 
@@ -111,7 +139,7 @@ size_t PQSize(const pq_t *queue)
 	assert(queue != NULL);
 	assert(queue->sorted_list != NULL);
 	
-	return SortedlistSize(queue->sorted_list);
+	return SkiplistSize(queue->sorted_list);
 }
 
 
@@ -131,26 +159,26 @@ void PQClear(pq_t *queue)
 
 void *PQErase(pq_t *queue, pq_match_func_t is_match, void *param) 
 {	
-	sortedlist_iter_t from;
-	sortedlist_iter_t to;
-	sortedlist_iter_t found;
+	skiplist_iter_t from;
+	skiplist_iter_t to;
+	skiplist_iter_t found;
 	void *data = NULL;
 	
 	assert(queue != NULL);
 	assert(is_match != NULL);
 	assert(queue->sorted_list != NULL);
 
-	from = SortedlistGetBegin(queue->sorted_list);
-	to = SortedlistGetEnd(queue->sorted_list);
-	found = SortedlistFindIf(from, to, is_match, param);
+	from = SkiplistGetBegin(queue->sorted_list);
+	to = SkiplistGetEnd(queue->sorted_list);
+	found = SkiplistFindIf(from, to, is_match, param);
 	
-	if (SortedlistIsSameIter(found, to)) 
+	if (SkiplistIsSameIter(found, to)) 
 	{
         return NULL;
     }
     
-	data = SortedlistGetData(found);
-	SortedlistRemove(found);
+	data = SkiplistGetData(found);
+	SkiplistRemove(found);
 	return data;
 }
 
@@ -0,0 +1,337 @@
+/*
+   Code by: Or Yamin
+   Project: radix heap for monotone integer keys
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* A min-priority queue for size_t keys that never go below the last popped
+   key - timestamps, deadlines, simulation clocks. No comparator is called:
+   an element lives in the bucket named by the highest bit in which its key
+   differs from the last popped key, so a push is O(1). When bucket 0 (keys
+   equal to the last popped one) runs dry, the lowest non-empty bucket is
+   emptied into lower buckets around its minimum. Every element can only
+   move down, so a pop is amortized O(log C), C being the key range. */
+
+#include <stdlib.h> /* size_t malloc() realloc() free() */
+#include <assert.h> /* assert() */
+#include <limits.h> /* CHAR_BIT */
+
+#include "radix_heap.h"
+
+#define KEY_BITS (sizeof(size_t) * CHAR_BIT)
+#define NUM_BUCKETS (KEY_BITS + 1)
+#define GROWTH_FACTOR 2
+#define MIN_BUCKET_CAPACITY 8
+
+struct radix_entry
+{
+	size_t key;
+	void *data;
+};
+
+struct radix_bucket
+{
+	struct radix_entry *entries;
+	size_t size;
+	size_t capacity;
+};
+
+struct radix_heap
+{
+	size_t last_key;
+	size_t size;
+	struct radix_bucket buckets[NUM_BUCKETS];
+};
+
+static size_t BucketIndex(size_t key, size_t last_key);
+static int Append(struct radix_bucket *bucket, size_t key, void *data);
+static int Reserve(struct radix_bucket *bucket, size_t capacity);
+static int Refill(radix_heap_t *heap);
+
+
+radix_heap_t *RadixHeapCreate(void)
+{
+	radix_heap_t *heap = NULL;
+	size_t i = 0;
+
+	heap = (radix_heap_t *)malloc(sizeof(radix_heap_t));
+	if (NULL == heap)
+	{
+		return NULL;
+	}
+
+	heap->last_key = 0;
+	heap->size = 0;
+
+	/* buckets get their arrays on first use */
+	for (i = 0; i < NUM_BUCKETS; ++i)
+	{
+		heap->buckets[i].entries = NULL;
+		heap->buckets[i].size = 0;
+		heap->buckets[i].capacity = 0;
+	}
+
+	return heap;
+}
+
+
+
+void RadixHeapDestroy(radix_heap_t *heap)
+{
+	size_t i = 0;
+
+	assert(NULL != heap);
+
+	for (i = 0; i < NUM_BUCKETS; ++i)
+	{
+		free(heap->buckets[i].entries);
+	}
+
+	free(heap);
+}
+
+
+
+/* key must not be smaller than the last popped key. NULL data is rejected,
+   since a NULL from RadixHeapPop or RadixHeapPeek means failure */
+int RadixHeapPush(radix_heap_t *heap, size_t key, void *data)
+{
+	assert(NULL != heap);
+	assert(key >= heap->last_key);
+
+	if (NULL == data)
+	{
+		return 1;
+	}
+
+	if (0 != Append(&heap->buckets[BucketIndex(key, heap->last_key)], key,
+																		data))
+	{
+		return 1;
+	}
+
+	++heap->size;
+
+	return 0;
+}
+
+
+
+/* pops an element with the smallest key; key may be NULL. Returns NULL,
+   leaving the heap unchanged, if a bucket could not grow */
+void *RadixHeapPop(radix_heap_t *heap, size_t *key)
+{
+	struct radix_bucket *bucket = NULL;
+
+	assert(NULL != heap);
+	assert(0 < heap->size);
+
+	if (0 != Refill(heap))
+	{
+		return NULL;
+	}
+
+	bucket = &heap->buckets[0];
+	--bucket->size;
+	--heap->size;
+
+	if (NULL != key)
+	{
+		*key = bucket->entries[bucket->size].key;
+	}
+
+	return bucket->entries[bucket->size].data;
+}
+
+
+
+/* not const: finding the minimum may redistribute a bucket, so it can fail
+   like RadixHeapPop */
+void *RadixHeapPeek(radix_heap_t *heap, size_t *key)
+{
+	struct radix_bucket *bucket = NULL;
+
+	assert(NULL != heap);
+	assert(0 < heap->size);
+
+	if (0 != Refill(heap))
+	{
+		return NULL;
+	}
+
+	bucket = &heap->buckets[0];
+	if (NULL != key)
+	{
+		*key = bucket->entries[bucket->size - 1].key;
+	}
+
+	return bucket->entries[bucket->size - 1].data;
+}
+
+
+
+/* the lower bound for the keys that may still be pushed */
+size_t RadixHeapLastKey(const radix_heap_t *heap)
+{
+	assert(NULL != heap);
+	return heap->last_key;
+}
+
+
+
+size_t RadixHeapSize(const radix_heap_t *heap)
+{
+	assert(NULL != heap);
+	return heap->size;
+}
+
+
+
+int RadixHeapIsEmpty(const radix_heap_t *heap)
+{
+	assert(NULL != heap);
+	return (0 == heap->size);
+}
+
+
+
+/* keeps the bucket arrays and the last key, so pushes stay monotone */
+void RadixHeapClear(radix_heap_t *heap)
+{
+	size_t i = 0;
+
+	assert(NULL != heap);
+
+	for (i = 0; i < NUM_BUCKETS; ++i)
+	{
+		heap->buckets[i].size = 0;
+	}
+
+	heap->size = 0;
+}
+
+
+/**************************************** Helpers *****************************/
+/* 0 for key == last_key, otherwise one more than the index of the highest
+   bit where they differ. The bit length is found by halving the shift, so
+   it takes log2(KEY_BITS) steps */
+static size_t BucketIndex(size_t key, size_t last_key)
+{
+	size_t diff = key ^ last_key;
+	size_t index = 0;
+	size_t shift = 0;
+
+	for (shift = KEY_BITS / 2; 0 < shift; shift /= 2)
+	{
+		if (0 != (diff >> shift))
+		{
+			diff >>= shift;
+			index += shift;
+		}
+	}
+
+	/* diff is down to its top bit, or 0 */
+	return index + diff;
+}
+
+static int Append(struct radix_bucket *bucket, size_t key, void *data)
+{
+	if (bucket->size == bucket->capacity && 0 != Reserve(bucket,
+					(0 == bucket->capacity) ? MIN_BUCKET_CAPACITY :
+											bucket->capacity * GROWTH_FACTOR))
+	{
+		return 1;
+	}
+
+	bucket->entries[bucket->size].key = key;
+	bucket->entries[bucket->size].data = data;
+	++bucket->size;
+
+	return 0;
+}
+
+static int Reserve(struct radix_bucket *bucket, size_t capacity)
+{
+	struct radix_entry *new_entries = NULL;
+
+	if (capacity <= bucket->capacity)
+	{
+		return 0;
+	}
+
+	new_entries = (struct radix_entry *)realloc(bucket->entries,
+										capacity * sizeof(struct radix_entry));
+	if (NULL == new_entries)
+	{
+		return 1;
+	}
+
+	bucket->entries = new_entries;
+	bucket->capacity = capacity;
+
+	return 0;
+}
+
+/* makes bucket 0 non-empty: the lowest non-empty bucket holds the minimum,
+   which becomes the new last key, and all its entries then fall into lower
+   buckets. The targets are grown first, so either every entry moves or, if
+   memory runs out, nothing changes and 1 is returned */
+static int Refill(radix_heap_t *heap)
+{
+	size_t counts[NUM_BUCKETS] = {0};
+	struct radix_bucket *bucket = NULL;
+	struct radix_entry *entry = NULL;
+	size_t min_key = 0;
+	size_t i = 1;
+	size_t j = 0;
+
+	if (0 < heap->buckets[0].size)
+	{
+		return 0;
+	}
+
+	while (0 == heap->buckets[i].size)
+	{
+		++i;
+	}
+	bucket = &heap->buckets[i];
+
+	min_key = bucket->entries[0].key;
+	for (j = 1; j < bucket->size; ++j)
+	{
+		if (bucket->entries[j].key < min_key)
+		{
+			min_key = bucket->entries[j].key;
+		}
+	}
+
+	for (j = 0; j < bucket->size; ++j)
+	{
+		++counts[BucketIndex(bucket->entries[j].key, min_key)];
+	}
+
+	/* only buckets below i are targets, and they are all empty */
+	for (j = 0; j < i; ++j)
+	{
+		if (0 != Reserve(&heap->buckets[j], counts[j]))
+		{
+			return 1;
+		}
+	}
+
+	heap->last_key = min_key;
+
+	for (j = 0; j < bucket->size; ++j)
+	{
+		entry = &bucket->entries[j];
+		Append(&heap->buckets[BucketIndex(entry->key, min_key)], entry->key,
+																entry->data);
+	}
+	bucket->size = 0;
+
+	return 0;
+}
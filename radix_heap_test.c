@@ -0,0 +1,197 @@
+/*
+   Code by: Or Yamin
+   Project: radix heap for monotone integer keys - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stdlib.h> /* rand() srand() */
+
+#include "radix_heap.h"
+
+#define ITEMS 5000
+#define EVENTS 20000
+#define MAX_DELAY 300
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+static int failures = 0;
+static size_t keys[ITEMS];
+
+static void TestOrder(void);
+static void TestEventLoop(void);
+static void TestWideKeys(void);
+static void TestClearAndNull(void);
+
+
+int main(void)
+{
+	size_t i = 0;
+
+	srand(13);
+	for (i = 0; i < ITEMS; ++i)
+	{
+		keys[i] = (size_t)(rand() % 100000);
+	}
+
+	TestOrder();
+	TestEventLoop();
+	TestWideKeys();
+	TestClearAndNull();
+
+	if (0 == failures)
+	{
+		puts("radix_heap: all tests passed");
+	}
+
+	return failures;
+}
+
+
+/* with every key pushed up front, pops come out sorted by key */
+static void TestOrder(void)
+{
+	radix_heap_t *heap = RadixHeapCreate();
+	int taken[ITEMS] = {0};
+	size_t *data = NULL;
+	size_t key = 0;
+	size_t last = 0;
+	size_t i = 0;
+
+	CHECK(NULL != heap);
+	CHECK(RadixHeapIsEmpty(heap));
+	CHECK(0 == RadixHeapLastKey(heap));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		CHECK(0 == RadixHeapPush(heap, keys[i], &keys[i]));
+	}
+	CHECK(ITEMS == RadixHeapSize(heap));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		CHECK(RadixHeapPeek(heap, NULL) == RadixHeapPeek(heap, &key));
+		data = (size_t *)RadixHeapPop(heap, &key);
+		CHECK(NULL != data);
+		CHECK(*data == key);
+		CHECK(last <= key);
+		CHECK(key == RadixHeapLastKey(heap));
+		++taken[data - keys];
+		last = key;
+	}
+	CHECK(RadixHeapIsEmpty(heap));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		CHECK(1 == taken[i]);
+	}
+
+	RadixHeapDestroy(heap);
+}
+
+/* the intended use: every popped event schedules a later one, so pushes
+   and pops interleave with keys that only move forwards */
+static void TestEventLoop(void)
+{
+	radix_heap_t *heap = RadixHeapCreate();
+	size_t *times = (size_t *)malloc(EVENTS * sizeof(size_t));
+	size_t *event = NULL;
+	size_t key = 0;
+	size_t now = 0;
+	size_t scheduled = 0;
+	size_t i = 0;
+
+	for (scheduled = 0; scheduled < 100; ++scheduled)
+	{
+		times[scheduled] = (size_t)(rand() % MAX_DELAY);
+		RadixHeapPush(heap, times[scheduled], &times[scheduled]);
+	}
+
+	for (i = 0; !RadixHeapIsEmpty(heap); ++i)
+	{
+		event = (size_t *)RadixHeapPop(heap, &key);
+		CHECK(*event == key);
+		CHECK(now <= key);
+		now = key;
+
+		if (scheduled < EVENTS)
+		{
+			times[scheduled] = now + (size_t)(rand() % MAX_DELAY);
+			CHECK(0 == RadixHeapPush(heap, times[scheduled],
+														&times[scheduled]));
+			++scheduled;
+		}
+	}
+	CHECK(EVENTS == i);
+
+	free(times);
+	RadixHeapDestroy(heap);
+}
+
+/* keys near the top of size_t land in the highest buckets */
+static void TestWideKeys(void)
+{
+	radix_heap_t *heap = RadixHeapCreate();
+	size_t wide[] = {(size_t)-1, 0, (size_t)-1 / 2, (size_t)-1 - 1, 1,
+														(size_t)-1 / 2 + 1};
+	size_t sorted[] = {0, 1, (size_t)-1 / 2, (size_t)-1 / 2 + 1,
+												(size_t)-1 - 1, (size_t)-1};
+	size_t key = 0;
+	size_t i = 0;
+
+	for (i = 0; i < 6; ++i)
+	{
+		RadixHeapPush(heap, wide[i], &wide[i]);
+	}
+
+	for (i = 0; i < 6; ++i)
+	{
+		RadixHeapPop(heap, &key);
+		CHECK(sorted[i] == key);
+	}
+
+	/* the last key is the maximum, and it can still be pushed */
+	CHECK(0 == RadixHeapPush(heap, (size_t)-1, &wide[0]));
+	CHECK(&wide[0] == RadixHeapPop(heap, NULL));
+
+	RadixHeapDestroy(heap);
+}
+
+static void TestClearAndNull(void)
+{
+	radix_heap_t *heap = RadixHeapCreate();
+	size_t i = 0;
+
+	/* NULL is what Pop returns on failure, so it cannot be stored */
+	CHECK(1 == RadixHeapPush(heap, 5, NULL));
+	CHECK(RadixHeapIsEmpty(heap));
+
+	for (i = 0; i < 100; ++i)
+	{
+		RadixHeapPush(heap, keys[i], &keys[i]);
+	}
+	RadixHeapPop(heap, NULL);
+
+	/* Clear keeps the last key, so the heap stays monotone */
+	RadixHeapClear(heap);
+	CHECK(RadixHeapIsEmpty(heap));
+	CHECK(0 < RadixHeapLastKey(heap));
+
+	CHECK(0 == RadixHeapPush(heap, RadixHeapLastKey(heap), &keys[0]));
+	CHECK(&keys[0] == RadixHeapPop(heap, NULL));
+
+	RadixHeapDestroy(heap);
+}
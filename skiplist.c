@@ -0,0 +1,551 @@
+/*
+Code by: Or Yamin
+Project: skip list (sorted list with expected O(log n) search)
+Date: 19/10/2026
+Review by:
+Review date:
+Approved by:
+Approved date:
+*/
+
+/* Same API and iterator semantics as sortedlist. Every node carries its
+   tower of forward links inline, right after the data and back pointers,
+   so a node is one allocation and the links of one node share cache lines.
+   All levels are circular through the head node, which is also the end
+   iterator; level 0 is doubly linked so Prev works. */
+
+#include <stdlib.h> /* size_t malloc() free() */
+#include <assert.h> /* assert() */
+
+#include "skiplist.h"
+
+#define MAX_LEVEL 24
+#define LEVEL_BITS 2 /* every level is 1 / 2^LEVEL_BITS as dense */
+#define LEVEL_MASK ((1UL << LEVEL_BITS) - 1)
+#define RNG_SEED 0x9E3779B9UL
+#define RNG_MASK 0xFFFFFFFFUL /* unsigned long may be wider than 32 bits */
+#define RNG_BITS 32
+
+struct skiplist_node
+{
+    void *data;
+    struct skiplist_node *prev;
+    size_t level;
+    struct skiplist_node *next[1];
+};
+
+struct skiplist
+{
+    struct skiplist_node *head;
+    skiplist_cmp_func_t compare;
+    size_t size;
+    size_t level;
+    unsigned long rng_state;
+};
+
+
+static struct skiplist_node *CreateNode(size_t level, void *data);
+static size_t RandomLevel(skiplist_t *list);
+static unsigned long NextRandom(skiplist_t *list);
+static void FindPreds(const skiplist_t *list, const void *data,
+							struct skiplist_node **update, int is_upper_bound);
+static void LinkNode(skiplist_t *list, struct skiplist_node *node,
+											struct skiplist_node **update);
+static void UnlinkNode(skiplist_t *list, struct skiplist_node *node);
+static skiplist_iter_t MakeIter(const skiplist_t *list,
+												struct skiplist_node *node);
+
+
+skiplist_t *SkiplistCreate(skiplist_cmp_func_t compare)
+{
+	skiplist_t *list = NULL;
+	size_t i = 0;
+
+	assert(NULL != compare);
+
+	list = (skiplist_t *)malloc(sizeof(skiplist_t));
+	if (NULL == list)
+	{
+		return NULL;
+	}
+
+	list->head = CreateNode(MAX_LEVEL, NULL);
+	if (NULL == list->head)
+	{
+		free(list);
+		return NULL;
+	}
+
+	for (i = 0; i < MAX_LEVEL; ++i)
+	{
+		list->head->next[i] = list->head;
+	}
+	list->head->prev = list->head;
+
+	list->compare = compare;
+	list->size = 0;
+	list->level = 1;
+	/* xorshift never leaves 0, so the low bit is forced on */
+	list->rng_state = ((RNG_SEED ^ (unsigned long)list) & RNG_MASK) | 1;
+
+	return list;
+}
+
+
+
+void SkiplistDestroy(skiplist_t *list)
+{
+	struct skiplist_node *current = NULL;
+	struct skiplist_node *next = NULL;
+
+	assert(NULL != list);
+
+	for (current = list->head->next[0]; current != list->head; current = next)
+	{
+		next = current->next[0];
+		free(current);
+	}
+
+	free(list->head);
+	free(list);
+}
+
+
+
+skiplist_iter_t SkiplistNext(skiplist_iter_t iter)
+{
+	assert(NULL != iter.node);
+	assert(iter.node != iter.list->head);
+
+	iter.node = iter.node->next[0];
+	return iter;
+}
+
+
+
+skiplist_iter_t SkiplistPrev(skiplist_iter_t iter)
+{
+	assert(NULL != iter.node);
+	assert(iter.node->prev != iter.list->head);
+
+	iter.node = iter.node->prev;
+	return iter;
+}
+
+
+
+skiplist_iter_t SkiplistGetBegin(const skiplist_t *list)
+{
+	assert(NULL != list);
+	return MakeIter(list, list->head->next[0]);
+}
+
+
+
+skiplist_iter_t SkiplistGetEnd(const skiplist_t *list)
+{
+	assert(NULL != list);
+	return MakeIter(list, list->head);
+}
+
+
+
+skiplist_iter_t SkiplistInsert(skiplist_t *list, void *data)
+{
+	struct skiplist_node *update[MAX_LEVEL];
+	struct skiplist_node *node = NULL;
+
+	assert(NULL != list);
+	assert(NULL != data);
+
+	node = CreateNode(RandomLevel(list), data);
+	if (NULL == node)
+	{
+		return SkiplistGetEnd(list);
+	}
+
+	/* after any equal elements, like SortedlistInsert */
+	FindPreds(list, data, update, 1);
+	LinkNode(list, node, update);
+
+	return MakeIter(list, node);
+}
+
+
+
+skiplist_iter_t SkiplistRemove(skiplist_iter_t where)
+{
+	struct skiplist_node *next = NULL;
+
+	assert(NULL != where.node);
+	assert(where.node != where.list->head);
+
+	next = where.node->next[0];
+	UnlinkNode(where.list, where.node);
+	free(where.node);
+
+	where.node = next;
+	return where;
+}
+
+
+
+/* call after the key of the element at where was changed in place; the same
+   node is moved to its new position, so iterators to it stay valid */
+skiplist_iter_t SkiplistUpdate(skiplist_iter_t where)
+{
+	struct skiplist_node *update[MAX_LEVEL];
+	struct skiplist_node *node = NULL;
+	skiplist_t *list = NULL;
+
+	assert(NULL != where.node);
+	assert(where.node != where.list->head);
+
+	node = where.node;
+	list = where.list;
+
+	/* still between its neighbours - nothing to move */
+	if ((node->prev == list->head ||
+			0 >= list->compare(node->prev->data, node->data)) &&
+		(node->next[0] == list->head ||
+			0 >= list->compare(node->data, node->next[0]->data)))
+	{
+		return where;
+	}
+
+	UnlinkNode(list, node);
+	FindPreds(list, node->data, update, 1);
+	LinkNode(list, node, update);
+
+	return where;
+}
+
+
+
+size_t SkiplistSize(const skiplist_t *list)
+{
+	assert(NULL != list);
+	return list->size;
+}
+
+
+
+void *SkiplistGetData(skiplist_iter_t iter)
+{
+	assert(NULL != iter.node);
+	return iter.node->data;
+}
+
+
+
+skiplist_iter_t SkiplistFind
+	(skiplist_t *list,
+	skiplist_iter_t from,
+	skiplist_iter_t to,
+	const void *param)
+{
+	struct skiplist_node *update[MAX_LEVEL];
+
+	assert(NULL != list);
+	assert(NULL != from.node);
+	assert(NULL != to.node);
+	assert(NULL != param);
+	assert(from.list == list && to.list == list);
+
+	/* a search over the whole list can use the towers */
+	if (from.node == list->head->next[0] && to.node == list->head)
+	{
+		FindPreds(list, param, update, 0);
+		return MakeIter(list, update[0]->next[0]);
+	}
+
+	while (from.node != to.node && list->compare(from.node->data, param) < 0)
+	{
+		from.node = from.node->next[0];
+	}
+
+	return from;
+}
+
+
+
+skiplist_iter_t SkiplistFindIf
+	(skiplist_iter_t from,
+	skiplist_iter_t to,
+	int (*is_match)(const void *data, const void *param),
+	void *param)
+{
+	assert(NULL != from.node);
+	assert(NULL != to.node);
+	assert(NULL != is_match);
+	assert(from.list == to.list);
+
+	while (from.node != to.node && !is_match(from.node->data, param))
+	{
+		from.node = from.node->next[0];
+	}
+
+	return from;
+}
+
+
+
+int SkiplistIsSameIter(skiplist_iter_t iter1, skiplist_iter_t iter2)
+{
+	assert(NULL != iter1.node);
+	assert(NULL != iter2.node);
+
+	return (iter1.node == iter2.node);
+}
+
+
+
+int SkiplistIsEmpty(const skiplist_t *list)
+{
+	assert(NULL != list);
+	return (0 == list->size);
+}
+
+
+
+void *SkiplistPopFront(skiplist_t *list)
+{
+	void *data = NULL;
+
+	assert(NULL != list);
+	assert(0 < list->size);
+
+	data = list->head->next[0]->data;
+	SkiplistRemove(SkiplistGetBegin(list));
+
+	return data;
+}
+
+
+
+void *SkiplistPopBack(skiplist_t *list)
+{
+	void *data = NULL;
+
+	assert(NULL != list);
+	assert(0 < list->size);
+
+	data = list->head->prev->data;
+	SkiplistRemove(MakeIter(list, list->head->prev));
+
+	return data;
+}
+
+
+
+/* moves every node of src into dest in one forward pass: src is sorted, so
+   the predecessors found for one node are the starting points for the next.
+   Like SortedlistMerge, src elements go before equal dest elements */
+void SkiplistMerge(skiplist_t *dest, skiplist_t *src)
+{
+	struct skiplist_node *update[MAX_LEVEL];
+	struct skiplist_node *node = NULL;
+	struct skiplist_node *runner = NULL;
+	size_t i = 0;
+
+	assert(NULL != dest);
+	assert(NULL != src);
+	assert(dest->compare == src->compare);
+
+	for (i = 0; i < MAX_LEVEL; ++i)
+	{
+		update[i] = dest->head;
+	}
+
+	while (!SkiplistIsEmpty(src))
+	{
+		node = src->head->next[0];
+		UnlinkNode(src, node);
+
+		for (i = 0; i < node->level; ++i)
+		{
+			runner = update[i];
+			while (runner->next[i] != dest->head &&
+					0 > dest->compare(runner->next[i]->data, node->data))
+			{
+				runner = runner->next[i];
+			}
+			update[i] = runner;
+		}
+
+		LinkNode(dest, node, update);
+
+		/* the new node is the closest predecessor for what comes next */
+		for (i = 0; i < node->level; ++i)
+		{
+			update[i] = node;
+		}
+	}
+}
+
+
+
+int SkiplistForEach
+	(skiplist_iter_t from,
+	skiplist_iter_t to,
+	int (*action)(void *data, void *param),
+	void *param)
+{
+	int status = 0;
+
+	assert(NULL != from.node);
+	assert(NULL != to.node);
+	assert(NULL != action);
+	assert(from.list == to.list);
+
+	for (; from.node != to.node; from.node = from.node->next[0])
+	{
+		status = action(from.node->data, param);
+	}
+
+	return status;
+}
+
+
+/**************************************** Helpers *****************************/
+static struct skiplist_node *CreateNode(size_t level, void *data)
+{
+	struct skiplist_node *node = (struct skiplist_node *)malloc(
+							sizeof(struct skiplist_node) +
+							(level - 1) * sizeof(struct skiplist_node *));
+	if (NULL == node)
+	{
+		return NULL;
+	}
+
+	node->data = data;
+	node->level = level;
+
+	return node;
+}
+
+/* a fresh word is drawn when the bits of the last one run out, which only
+   happens for levels past RNG_BITS / LEVEL_BITS */
+static size_t RandomLevel(skiplist_t *list)
+{
+	unsigned long bits = NextRandom(list);
+	size_t bits_left = RNG_BITS;
+	size_t level = 1;
+
+	while (level < MAX_LEVEL && 0 == (bits & LEVEL_MASK))
+	{
+		++level;
+		bits >>= LEVEL_BITS;
+		bits_left -= LEVEL_BITS;
+		if (0 == bits_left)
+		{
+			bits = NextRandom(list);
+			bits_left = RNG_BITS;
+		}
+	}
+
+	return level;
+}
+
+/* xorshift32: cheap, and private to the list so no global rand() state.
+   Kept to 32 bits so it behaves the same whatever the width of long */
+static unsigned long NextRandom(skiplist_t *list)
+{
+	unsigned long x = list->rng_state;
+
+	x ^= (x << 13) & RNG_MASK;
+	x ^= x >> 17;
+	x ^= (x << 5) & RNG_MASK;
+	list->rng_state = x;
+
+	return x;
+}
+
+/* update[i] becomes the last node at level i ordered before data; with
+   is_upper_bound equal elements count as before, otherwise as after */
+static void FindPreds(const skiplist_t *list, const void *data,
+							struct skiplist_node **update, int is_upper_bound)
+{
+	struct skiplist_node *runner = list->head;
+	size_t i = MAX_LEVEL;
+	int cmp = 0;
+
+	while (0 < i)
+	{
+		--i;
+		if (i < list->level)
+		{
+			while (runner->next[i] != list->head)
+			{
+				cmp = list->compare(runner->next[i]->data, data);
+				if (0 < cmp || (0 == cmp && !is_upper_bound))
+				{
+					break;
+				}
+				runner = runner->next[i];
+			}
+		}
+		update[i] = runner;
+	}
+}
+
+static void LinkNode(skiplist_t *list, struct skiplist_node *node,
+											struct skiplist_node **update)
+{
+	size_t i = 0;
+
+	for (i = 0; i < node->level; ++i)
+	{
+		node->next[i] = update[i]->next[i];
+		update[i]->next[i] = node;
+	}
+
+	node->prev = update[0];
+	node->next[0]->prev = node;
+
+	if (list->level < node->level)
+	{
+		list->level = node->level;
+	}
+	++list->size;
+}
+
+/* unhooks node from every level of its tower. The predecessor at level i is
+   the closest node before it that is at least i + 1 high, so the search walks
+   back along level 0 and never compares keys - it works even when the key of
+   node has already been changed, and does not scan runs of equal elements */
+static void UnlinkNode(skiplist_t *list, struct skiplist_node *node)
+{
+	struct skiplist_node *runner = node->prev;
+	size_t i = 0;
+
+	for (i = 0; i < node->level; ++i)
+	{
+		while (runner != list->head && runner->level <= i)
+		{
+			runner = runner->prev;
+		}
+
+		assert(runner->next[i] == node);
+		runner->next[i] = node->next[i];
+	}
+
+	node->next[0]->prev = node->prev;
+
+	while (1 < list->level && list->head->next[list->level - 1] == list->head)
+	{
+		--list->level;
+	}
+	--list->size;
+}
+
+static skiplist_iter_t MakeIter(const skiplist_t *list,
+												struct skiplist_node *node)
+{
+	skiplist_iter_t iter;
+
+	iter.node = node;
+	iter.list = (skiplist_t *)list;
+
+	return iter;
+}
@@ -0,0 +1,265 @@
+/*
+   Code by: Or Yamin
+   Project: skip list - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stdlib.h> /* rand() srand() */
+
+#include "skiplist.h"
+
+#define ITEMS 5000
+#define KEY_RANGE 1000
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+/* seq records insertion order, to check where equal keys land */
+struct item
+{
+	int key;
+	int seq;
+};
+
+static int failures = 0;
+static struct item items[ITEMS];
+
+static void TestInsertOrder(void);
+static void TestFindRemove(void);
+static void TestUpdate(void);
+static void TestMerge(void);
+static skiplist_t *FillRandom(size_t count);
+static int IsSorted(const skiplist_t *list);
+static int CompareItems(const void *data1, const void *data2);
+static int IsKey(const void *data, const void *param);
+static int CountItems(void *data, void *param);
+
+
+int main(void)
+{
+	TestInsertOrder();
+	TestFindRemove();
+	TestUpdate();
+	TestMerge();
+
+	if (0 == failures)
+	{
+		puts("skiplist: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestInsertOrder(void)
+{
+	skiplist_t *list = SkiplistCreate(CompareItems);
+	skiplist_iter_t iter;
+	int count = 0;
+
+	CHECK(NULL != list);
+	CHECK(SkiplistIsEmpty(list));
+	CHECK(SkiplistIsSameIter(SkiplistGetBegin(list), SkiplistGetEnd(list)));
+	SkiplistDestroy(list);
+
+	list = FillRandom(ITEMS);
+	CHECK(ITEMS == SkiplistSize(list));
+	CHECK(IsSorted(list));
+
+	/* Prev walks the same elements back */
+	for (iter = SkiplistGetEnd(list); !SkiplistIsSameIter(iter,
+								SkiplistGetBegin(list)); ++count)
+	{
+		iter = SkiplistPrev(iter);
+	}
+	CHECK(ITEMS == count);
+
+	count = 0;
+	CHECK(0 == SkiplistForEach(SkiplistGetBegin(list), SkiplistGetEnd(list),
+														CountItems, &count));
+	CHECK(ITEMS == count);
+
+	SkiplistDestroy(list);
+}
+
+static void TestFindRemove(void)
+{
+	skiplist_t *list = FillRandom(ITEMS);
+	struct item key = {0, 0};
+	skiplist_iter_t found;
+	struct item *data = NULL;
+	size_t removed = 0;
+
+	/* Find is a lower bound: the first element not less than the key */
+	for (key.key = -1; key.key <= KEY_RANGE; key.key += 7)
+	{
+		found = SkiplistFind(list, SkiplistGetBegin(list),
+												SkiplistGetEnd(list), &key);
+		if (!SkiplistIsSameIter(found, SkiplistGetEnd(list)))
+		{
+			data = (struct item *)SkiplistGetData(found);
+			CHECK(data->key >= key.key);
+		}
+		if (!SkiplistIsSameIter(found, SkiplistGetBegin(list)))
+		{
+			data = (struct item *)SkiplistGetData(SkiplistPrev(found));
+			CHECK(data->key < key.key);
+		}
+	}
+
+	found = SkiplistFindIf(SkiplistGetBegin(list), SkiplistGetEnd(list),
+													IsKey, &items[10].key);
+	CHECK(items[10].key == ((struct item *)SkiplistGetData(found))->key);
+
+	/* remove every other element through the returned iterators */
+	found = SkiplistGetBegin(list);
+	while (!SkiplistIsSameIter(found, SkiplistGetEnd(list)))
+	{
+		found = SkiplistRemove(found);
+		++removed;
+		if (!SkiplistIsSameIter(found, SkiplistGetEnd(list)))
+		{
+			found = SkiplistNext(found);
+		}
+	}
+	CHECK(ITEMS / 2 == removed);
+	CHECK(ITEMS - removed == SkiplistSize(list));
+	CHECK(IsSorted(list));
+
+	data = (struct item *)SkiplistGetData(SkiplistGetBegin(list));
+	CHECK(data == SkiplistPopFront(list));
+	data = (struct item *)SkiplistGetData(SkiplistPrev(SkiplistGetEnd(list)));
+	CHECK(data == SkiplistPopBack(list));
+	CHECK(ITEMS - removed - 2 == SkiplistSize(list));
+
+	SkiplistDestroy(list);
+}
+
+/* changing a key in place and calling Update moves the same node */
+static void TestUpdate(void)
+{
+	skiplist_t *list = FillRandom(ITEMS);
+	skiplist_iter_t iter = SkiplistGetBegin(list);
+	struct item *data = (struct item *)SkiplistGetData(iter);
+
+	data->key = KEY_RANGE + 1;
+	iter = SkiplistUpdate(iter);
+	CHECK(data == SkiplistGetData(iter));
+	CHECK(data == SkiplistGetData(SkiplistPrev(SkiplistGetEnd(list))));
+	CHECK(IsSorted(list));
+
+	data->key = -1;
+	iter = SkiplistUpdate(iter);
+	CHECK(data == SkiplistGetData(SkiplistGetBegin(list)));
+	CHECK(IsSorted(list));
+
+	SkiplistDestroy(list);
+}
+
+/* merged src elements go before the dest elements equal to them */
+static void TestMerge(void)
+{
+	skiplist_t *dest = SkiplistCreate(CompareItems);
+	skiplist_t *src = SkiplistCreate(CompareItems);
+	struct item dest_items[] = {{1, 0}, {3, 0}, {5, 0}};
+	struct item src_items[] = {{0, 1}, {3, 1}, {5, 1}, {9, 1}};
+	int expected_keys[] = {0, 1, 3, 3, 5, 5, 9};
+	int expected_seqs[] = {1, 0, 1, 0, 1, 0, 1};
+	skiplist_iter_t iter;
+	struct item *data = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < 3; ++i)
+	{
+		SkiplistInsert(dest, &dest_items[i]);
+	}
+	for (i = 0; i < 4; ++i)
+	{
+		SkiplistInsert(src, &src_items[i]);
+	}
+
+	SkiplistMerge(dest, src);
+	CHECK(SkiplistIsEmpty(src));
+	CHECK(7 == SkiplistSize(dest));
+
+	for (i = 0, iter = SkiplistGetBegin(dest);
+			!SkiplistIsSameIter(iter, SkiplistGetEnd(dest));
+											++i, iter = SkiplistNext(iter))
+	{
+		data = (struct item *)SkiplistGetData(iter);
+		CHECK(expected_keys[i] == data->key);
+		CHECK(expected_seqs[i] == data->seq);
+	}
+
+	SkiplistDestroy(dest);
+	SkiplistDestroy(src);
+}
+
+/* keys repeat, so equal elements are common */
+static skiplist_t *FillRandom(size_t count)
+{
+	skiplist_t *list = SkiplistCreate(CompareItems);
+	size_t i = 0;
+
+	srand(11);
+	for (i = 0; i < count; ++i)
+	{
+		items[i].key = rand() % KEY_RANGE;
+		items[i].seq = (int)i;
+		SkiplistInsert(list, &items[i]);
+	}
+
+	return list;
+}
+
+/* by key, and equal keys in insertion order */
+static int IsSorted(const skiplist_t *list)
+{
+	skiplist_iter_t iter = SkiplistGetBegin(list);
+	const struct item *prev = NULL;
+	const struct item *cur = NULL;
+
+	for (; !SkiplistIsSameIter(iter, SkiplistGetEnd(list));
+													iter = SkiplistNext(iter))
+	{
+		cur = (const struct item *)SkiplistGetData(iter);
+		if (NULL != prev && (prev->key > cur->key ||
+							(prev->key == cur->key && prev->seq > cur->seq)))
+		{
+			return 0;
+		}
+		prev = cur;
+	}
+
+	return 1;
+}
+
+static int CompareItems(const void *data1, const void *data2)
+{
+	return ((const struct item *)data1)->key - ((const struct item *)data2)->key;
+}
+
+static int IsKey(const void *data, const void *param)
+{
+	return (((const struct item *)data)->key == *(const int *)param);
+}
+
+static int CountItems(void *data, void *param)
+{
+	(void)data;
+	++*(int *)param;
+	return 0;
+}
@@ -6,6 +6,8 @@ written by Or Yamin on 10/05/2024*/
 
 #include "sllist.h"
 
+#define MAX_SORT_BINS 64
+
 
 struct sllist_node 
 {
@@ -22,6 +24,8 @@ struct sllist
 static int counter(void *data, void *param);
 static int IsDummy(sllist_iter_t iter);
 static sllist_iter_t CreateNode(sllist_iter_t next, void* data);
+static sllist_iter_t MergeChains(sllist_iter_t first, sllist_iter_t second, 
+														sllist_cmp_func_t cmp);
 
 sllist_t *SllistCreate(void) 
 {
@@ -227,6 +231,81 @@ void SllistAppend(sllist_t *dest, sllist_t *src)
 }
 
 
+/* bottom-up merge sort over the real nodes; the dummy stays the tail and
+   nodes are relinked, so iterators keep pointing at the same data */
+void SllistSort(sllist_t *sllist, sllist_cmp_func_t cmp)
+{
+	sllist_iter_t bins[MAX_SORT_BINS] = {NULL};
+	sllist_iter_t chain = NULL;
+	sllist_iter_t run = NULL;
+	size_t i = 0;
+	
+	assert(NULL != sllist);
+	assert(NULL != cmp);
+	
+	if (SllistIsEmpty(sllist))
+	{
+		return;
+	}
+	
+	chain = sllist->head;
+	while (chain != sllist->tail)
+	{
+		run = chain;
+		chain = chain->next;
+		run->next = NULL;
+		
+		for (i = 0; i < MAX_SORT_BINS - 1 && NULL != bins[i]; ++i)
+		{
+			run = MergeChains(bins[i], run, cmp);
+			bins[i] = NULL;
+		}
+		
+		bins[i] = MergeChains(bins[i], run, cmp);
+	}
+	
+	for (i = 0, run = NULL; i < MAX_SORT_BINS; ++i)
+	{
+		run = MergeChains(bins[i], run, cmp);
+	}
+	
+	sllist->head = run;
+	while (NULL != run->next)
+	{
+		run = run->next;
+	}
+	run->next = sllist->tail;
+}
+
+
+/* stable: on equal keys the node from first comes out first */
+static sllist_iter_t MergeChains(sllist_iter_t first, sllist_iter_t second, 
+														sllist_cmp_func_t cmp)
+{
+	sllist_iter_t merged = NULL;
+	sllist_iter_t *tail = &merged;
+	
+	while (NULL != first && NULL != second)
+	{
+		if (0 > cmp(second->data, first->data))
+		{
+			*tail = second;
+			second = second->next;
+		}
+		else
+		{
+			*tail = first;
+			first = first->next;
+		}
+		tail = &(*tail)->next;
+	}
+	
+	*tail = (NULL != first) ? first : second;
+	
+	return merged;
+}
+
+
 static int counter(void *data, void *param)
 {
 	(void)data;
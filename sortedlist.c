@@ -14,6 +14,7 @@ Approved date: 22/05/2024
 #include <assert.h> /* assert() */
 
 #include "dllist.h" 
+#include "heap.h"
 #include "sortedlist.h"
 
 struct sortedlist
@@ -22,6 +23,28 @@ struct sortedlist
     sortedlist_cmp_func_t compare;
 };
 
+/* one input of SortedlistMergeMany: the next node still to be merged from
+   one list, plus the rank that breaks ties between equal elements */
+struct merge_cursor
+{
+	sortedlist_iter_t runner;
+	sortedlist_iter_t end;
+	sortedlist_cmp_func_t compare;
+	size_t rank;
+};
+
+static sortedlist_iter_t SeekLowerBound(const sortedlist_t *sorted_list, 
+									sortedlist_iter_t hint, const void *param);
+static sortedlist_iter_t SeekUpperBound(const sortedlist_t *sorted_list, 
+									sortedlist_iter_t hint, const void *data);
+static int CursorCompare(const void *cursor1, const void *cursor2);
+static int IsCursorBefore(const struct merge_cursor *cursor, 
+										const struct merge_cursor *other);
+static void MergeRuns(sortedlist_t *dest, sortedlist_t *src, 
+														int is_src_first);
+static int IsSrcBefore(const sortedlist_t *dest, sortedlist_iter_t dest_runner, 
+							sortedlist_iter_t src_runner, int is_src_first);
+
 
 sortedlist_t *SortedlistCreate(sortedlist_cmp_func_t compare)
 {
@@ -133,6 +156,24 @@ sortedlist_iter_t SortedlistInsert(sortedlist_t *sorted_list, void *data)
 
 
 
+sortedlist_iter_t SortedlistInsertHint
+	(sortedlist_t *sorted_list, 
+	sortedlist_iter_t hint, 
+	void *data)
+{
+	assert(NULL != sorted_list);
+	assert(NULL != sorted_list->list);
+	assert(NULL != hint.iter);
+	assert(NULL != data);
+	
+	hint = SeekUpperBound(sorted_list, hint, data);
+	hint.iter = DllistInsertBefore(sorted_list->list, data, hint.iter);
+	
+	return hint;
+}
+
+
+
 sortedlist_iter_t SortedlistRemove(sortedlist_iter_t where)
 {
 	assert(NULL != where.iter);
@@ -185,6 +226,21 @@ sortedlist_iter_t SortedlistFind
 
 
 
+sortedlist_iter_t SortedlistFindHint
+	(sortedlist_t *sorted_list, 
+	sortedlist_iter_t hint, 
+	const void *param)
+{
+	assert(NULL != sorted_list);
+	assert(NULL != sorted_list->list);
+	assert(NULL != hint.iter);
+	assert(NULL != param);
+	
+	return SeekLowerBound(sorted_list, hint, param);
+}
+
+
+
 sortedlist_iter_t SortedlistFindIf
 	(sortedlist_iter_t from,
 	sortedlist_iter_t to, 
@@ -242,47 +298,144 @@ void *SortedlistPopBack(sortedlist_t *sorted_list)
 
 
 
+/* src elements go before the dest elements equal to them */
 void SortedlistMerge(sortedlist_t *dest, sortedlist_t *src)
 {
-	sortedlist_iter_t dest_runner = {NULL};
-	sortedlist_iter_t src_runner = {NULL};
-	sortedlist_iter_t src_from = {NULL};
-	
 	assert(NULL != dest);
 	assert(NULL != src);
 	assert(NULL != dest->list);
 	assert(NULL != src->list);
 	assert(dest->compare == src->compare);
 	
-	dest_runner = SortedlistGetBegin(dest);
-	src_runner = SortedlistGetBegin(src);
-	src_from = src_runner;
+	MergeRuns(dest, src, 1);
+}
+
+
+
+/* merges all of srcs into dest in one pass. A heap of cursors picks the list
+   holding the smallest next element, and the longest run of that list that
+   still comes before every other cursor is spliced over at once, so the cost
+   is O(N log k) comparisons and no node is allocated or freed. Equal
+   elements keep the order srcs[0], srcs[1], ..., dest. */
+int SortedlistMergeMany(sortedlist_t *dest, sortedlist_t **srcs, size_t count)
+{
+	struct merge_cursor *cursors = NULL;
+	struct merge_cursor *dest_cursor = NULL;
+	struct merge_cursor *cursor = NULL;
+	sortedlist_iter_t run_from = {NULL};
+	sortedlist_t *list = NULL;
+	heap_t *heap = NULL;
+	size_t i = 0;
 	
-	while(!SortedlistIsSameIter(dest_runner,SortedlistGetEnd(dest)))
+	assert(NULL != dest);
+	assert(NULL != dest->list);
+	assert(NULL != srcs || 0 == count);
+	
+	cursors = (struct merge_cursor *)malloc((count + 1) * 
+											sizeof(struct merge_cursor));
+	if (NULL == cursors)
+	{
+		return 1;
+	}
+	
+	heap = HeapCreate(CursorCompare);
+	if (NULL == heap)
 	{
-		if (!SortedlistIsSameIter(src_runner,SortedlistGetEnd(src)) && 0 > 
-			dest->compare(SortedlistGetData(dest_runner), 
-							SortedlistGetData(src_runner)))
+		free(cursors);
+		return 1;
+	}
+	
+	for (i = 0; i <= count; ++i)
+	{
+		list = (i < count) ? srcs[i] : dest;
+		assert(NULL != list);
+		assert(list->compare == dest->compare);
+		assert(list != dest || i == count);
+		
+		cursors[i].runner = SortedlistGetBegin(list);
+		cursors[i].end = SortedlistGetEnd(list);
+		cursors[i].compare = dest->compare;
+		cursors[i].rank = i;
+		
+		if (!SortedlistIsEmpty(list) && 0 != HeapPush(heap, &cursors[i]))
 		{
-			dest_runner = SortedlistNext(dest_runner);
+			HeapDestroy(heap);
+			free(cursors);
+			return 1;
 		}
-		else
+	}
+	
+	/* every node taken from a src goes right before dest's next unmerged
+	   node, which is where dest_cursor->runner points */
+	dest_cursor = &cursors[count];
+	
+	while (!HeapIsEmpty(heap))
+	{
+		cursor = (struct merge_cursor *)HeapPeek(heap);
+		HeapPop(heap);
+		
+		run_from = cursor->runner;
+		do
 		{
-			while(0 <= dest->compare(SortedlistGetData(dest_runner), 
-					SortedlistGetData(src_runner)))
-			{
-				src_runner = SortedlistNext(src_runner);
-			}
-			DllistSplice(dest_runner.iter, src_from.iter, src_runner.iter);
-			dest_runner = SortedlistNext(dest_runner);
-			src_from = src_runner;
+			cursor->runner = SortedlistNext(cursor->runner);
+		}
+		while (!SortedlistIsSameIter(cursor->runner, cursor->end) && 
+				(HeapIsEmpty(heap) || 
+				IsCursorBefore(cursor, (struct merge_cursor *)HeapPeek(heap))));
+		
+		if (cursor != dest_cursor)
+		{
+			DllistSplice(dest_cursor->runner.iter, run_from.iter, 
+														cursor->runner.iter);
 		}
+		
+		/* cannot fail: the heap already held this cursor */
+		if (!SortedlistIsSameIter(cursor->runner, cursor->end))
+		{
+			HeapPush(heap, cursor);
+		}
+	}
+	
+	HeapDestroy(heap);
+	free(cursors);
+	
+	return 0;
+}
+
+
+/* same result as count calls to SortedlistInsert: the batch is sorted
+   stably and each item lands after the elements already equal to it */
+int SortedlistInsertMany(sortedlist_t *sorted_list, void **data, size_t count)
+{
+	sortedlist_t *batch = NULL;
+	size_t i = 0;
+	
+	assert(NULL != sorted_list);
+	assert(NULL != sorted_list->list);
+	assert(NULL != data || 0 == count);
+	
+	batch = SortedlistCreate(sorted_list->compare);
+	if (NULL == batch)
+	{
+		return 1;
 	}
 	
-	if(!SortedlistIsEmpty(src))
+	for (i = 0; i < count; ++i)
 	{
-		DllistSplice(dest_runner.iter, src_from.iter, SortedlistGetEnd(src).iter);
+		assert(NULL != data[i]);
+		if (NULL == DllistPushBack(batch->list, data[i]))
+		{
+			SortedlistDestroy(batch);
+			return 1;
+		}
 	}
+	
+	/* O(K log K) to order the batch, then one linear merge pass */
+	DllistSort(batch->list, sorted_list->compare);
+	MergeRuns(sorted_list, batch, 0);
+	SortedlistDestroy(batch);
+	
+	return 0;
 }
 
 
@@ -305,3 +458,148 @@ int SortedlistForEach
 
 
 
+/********************************* Helpers ***********************************/
+/* walks from hint towards the first element not less than param; one
+   comparison picks the direction, so the cost is the distance from hint */
+static sortedlist_iter_t SeekLowerBound(const sortedlist_t *sorted_list, 
+									sortedlist_iter_t hint, const void *param)
+{
+	sortedlist_iter_t begin = SortedlistGetBegin(sorted_list);
+	sortedlist_iter_t end = SortedlistGetEnd(sorted_list);
+	
+	if (!SortedlistIsSameIter(hint, end) && 
+		0 > sorted_list->compare(SortedlistGetData(hint), param))
+	{
+		do
+		{
+			hint = SortedlistNext(hint);
+		}
+		while (!SortedlistIsSameIter(hint, end) && 
+				0 > sorted_list->compare(SortedlistGetData(hint), param));
+	}
+	else
+	{
+		while (!SortedlistIsSameIter(hint, begin) && 
+				0 <= sorted_list->compare(
+								SortedlistGetData(SortedlistPrev(hint)), param))
+		{
+			hint = SortedlistPrev(hint);
+		}
+	}
+	
+	#ifndef NDEBUG
+		hint.list = (sortedlist_t *)sorted_list;
+	#endif /* NDEBUG */
+	
+	return hint;
+}
+
+
+
+/* same walk, but stops after the elements equal to data, which is where
+   SortedlistInsert would put it */
+static sortedlist_iter_t SeekUpperBound(const sortedlist_t *sorted_list, 
+									sortedlist_iter_t hint, const void *data)
+{
+	sortedlist_iter_t begin = SortedlistGetBegin(sorted_list);
+	sortedlist_iter_t end = SortedlistGetEnd(sorted_list);
+	
+	if (!SortedlistIsSameIter(hint, end) && 
+		0 >= sorted_list->compare(SortedlistGetData(hint), data))
+	{
+		do
+		{
+			hint = SortedlistNext(hint);
+		}
+		while (!SortedlistIsSameIter(hint, end) && 
+				0 >= sorted_list->compare(SortedlistGetData(hint), data));
+	}
+	else
+	{
+		while (!SortedlistIsSameIter(hint, begin) && 
+				0 < sorted_list->compare(
+								SortedlistGetData(SortedlistPrev(hint)), data))
+		{
+			hint = SortedlistPrev(hint);
+		}
+	}
+	
+	#ifndef NDEBUG
+		hint.list = (sortedlist_t *)sorted_list;
+	#endif /* NDEBUG */
+	
+	return hint;
+}
+
+
+
+/* heap.c keeps the element that compares greatest on top, so the cursor
+   whose element must be merged first has to compare greatest */
+static int CursorCompare(const void *cursor1, const void *cursor2)
+{
+	const struct merge_cursor *first = (const struct merge_cursor *)cursor1;
+	const struct merge_cursor *second = (const struct merge_cursor *)cursor2;
+	
+	return IsCursorBefore(first, second) - IsCursorBefore(second, first);
+}
+
+
+
+static int IsCursorBefore(const struct merge_cursor *cursor, 
+										const struct merge_cursor *other)
+{
+	int result = cursor->compare(SortedlistGetData(cursor->runner), 
+										SortedlistGetData(other->runner));
+	
+	return (0 > result || (0 == result && cursor->rank < other->rank));
+}
+
+/* splices src into dest run by run. is_src_first picks the tie rule: src
+   before the equal dest elements (SortedlistMerge) or after them, as
+   SortedlistInsert would put them */
+static void MergeRuns(sortedlist_t *dest, sortedlist_t *src, 
+														int is_src_first)
+{
+	sortedlist_iter_t dest_runner = SortedlistGetBegin(dest);
+	sortedlist_iter_t dest_end = SortedlistGetEnd(dest);
+	sortedlist_iter_t src_runner = SortedlistGetBegin(src);
+	sortedlist_iter_t src_end = SortedlistGetEnd(src);
+	sortedlist_iter_t src_from = {NULL};
+	
+	while (!SortedlistIsSameIter(src_runner, src_end))
+	{
+		while (!SortedlistIsSameIter(dest_runner, dest_end) && 
+			!IsSrcBefore(dest, dest_runner, src_runner, is_src_first))
+		{
+			dest_runner = SortedlistNext(dest_runner);
+		}
+		
+		if (SortedlistIsSameIter(dest_runner, dest_end))
+		{
+			break;
+		}
+		
+		/* take the whole run of src that belongs before dest_runner */
+		src_from = src_runner;
+		while (!SortedlistIsSameIter(src_runner, src_end) && 
+			IsSrcBefore(dest, dest_runner, src_runner, is_src_first))
+		{
+			src_runner = SortedlistNext(src_runner);
+		}
+		DllistSplice(dest_runner.iter, src_from.iter, src_runner.iter);
+	}
+	
+	if (!SortedlistIsEmpty(src))
+	{
+		DllistSplice(dest_end.iter, SortedlistGetBegin(src).iter, src_end.iter);
+	}
+}
+
+static int IsSrcBefore(const sortedlist_t *dest, sortedlist_iter_t dest_runner, 
+							sortedlist_iter_t src_runner, int is_src_first)
+{
+	int result = dest->compare(SortedlistGetData(dest_runner), 
+										SortedlistGetData(src_runner));
+	
+	return (0 < result || (0 == result && is_src_first));
+}
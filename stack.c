@@ -4,73 +4,185 @@ was written by or yamin on 02/05/2024*/
 #include <stddef.h> /* size_t */
 #include <stdio.h> /* printf */
 #include <stdlib.h> /* free, malloc */
+#include <string.h> /* memcpy */
 #include <assert.h> /* assert */
 
 #include "stack.h"
 
 
+/* elements live right after the header, so a segment is a single malloc */
+struct stack_segment
+{
+	struct stack_segment *prev;
+	char *buffer;
+};
+
 struct stack
 {
-    size_t capacity;
+    size_t segment_capacity;
     size_t size;
+    size_t top_size;
     size_t element_size;
-    char *buffer;
+    size_t num_of_segments;
+    struct stack_segment *top;
+    struct stack_segment *spare;
 };
 
 
+static struct stack_segment *CreateSegment(stack_t *stack);
+static int PushSegment(stack_t *stack);
+static void PopSegment(stack_t *stack);
+
+
 stack_t *StackCreate(size_t capacity, size_t element_size)
 {
-	size_t buffer_size = element_size*capacity;
-	stack_t *stack_ptr = (stack_t *)malloc(sizeof(stack_t) + (buffer_size * sizeof(char)));
-	
+	stack_t *stack_ptr = NULL;
+
+	assert(0 < capacity);
+	assert(0 < element_size);
+
+	stack_ptr = (stack_t *)malloc(sizeof(stack_t));
 	if( NULL == stack_ptr )
 	{
-		free(stack_ptr);
 		return NULL;
 	}
-	
+
 	stack_ptr->size = 0;
+	stack_ptr->top_size = 0;
 	stack_ptr->element_size = element_size;
-	stack_ptr->capacity = capacity;
-	stack_ptr->buffer = ((char *)stack_ptr + (sizeof(stack_t)));
+	stack_ptr->segment_capacity = capacity;
+	stack_ptr->spare = NULL;
+	stack_ptr->top = CreateSegment(stack_ptr);
+	if( NULL == stack_ptr->top )
+	{
+		free(stack_ptr);
+		return NULL;
+	}
+
+	stack_ptr->top->prev = NULL;
+	stack_ptr->num_of_segments = 1;
+
 	return stack_ptr;
 }
 
 
 void StackDestroy(stack_t *stack)
 {
+	struct stack_segment *prev = NULL;
+
+	assert(stack);
+
+	while( NULL != stack->top )
+	{
+		prev = stack->top->prev;
+		free(stack->top);
+		stack->top = prev;
+	}
+
+	free(stack->spare);
 	free(stack);
 }
 
 
-void StackPush(stack_t *stack, void *new_element)
+int StackPush(stack_t *stack, void *new_element)
 {
-	char *temp_p = (char *)new_element;
-	size_t size_element = stack->size * stack->element_size;
-	size_t i = 0;
-	
-	if( stack->size == stack->capacity)
+	assert(stack);
+	assert(new_element);
+
+	if( stack->top_size == stack->segment_capacity && 0 != PushSegment(stack))
 	{
-		fprintf(stderr, "Stack is full, cannot push\n");
-		return;
+		return 1;
 	}
-	
-	for( i = 0; i < stack->element_size; i++ , temp_p++)
-	{
-		*(stack->buffer + size_element + i) = *temp_p;
 
-	}
-	stack->size++;
+	memcpy(stack->top->buffer + stack->top_size * stack->element_size,
+											new_element, stack->element_size);
+	++stack->top_size;
+	++stack->size;
+
+	return 0;
 }
-		
-	
+
+
 void StackPop(stack_t *stack)
 {
 	assert(stack);
 	assert(stack->size);
 
-	stack->size = stack->size - 1;
-}	
+	--stack->top_size;
+	--stack->size;
+
+	if( 0 == stack->top_size && NULL != stack->top->prev )
+	{
+		PopSegment(stack);
+	}
+}
+
+
+int StackPushMany(stack_t *stack, const void *elements, size_t count)
+{
+	const char *src = (const char *)elements;
+	size_t pushed = 0;
+	size_t chunk = 0;
+
+	assert(stack);
+	assert(elements || 0 == count);
+
+	while( pushed < count )
+	{
+		if( stack->top_size == stack->segment_capacity && 0 != PushSegment(stack))
+		{
+			/* all or nothing - undo the part that did fit */
+			StackPopMany(stack, NULL, pushed);
+			return 1;
+		}
+
+		chunk = stack->segment_capacity - stack->top_size;
+		if( chunk > count - pushed )
+		{
+			chunk = count - pushed;
+		}
+
+		memcpy(stack->top->buffer + stack->top_size * stack->element_size,
+								src + pushed * stack->element_size,
+								chunk * stack->element_size);
+		stack->top_size += chunk;
+		stack->size += chunk;
+		pushed += chunk;
+	}
+
+	return 0;
+}
+
+
+void StackPopMany(stack_t *stack, void *dest, size_t count)
+{
+	char *dest_p = (char *)dest;
+	size_t chunk = 0;
+
+	assert(stack);
+	assert(count <= stack->size);
+
+	/* the top of the stack goes to the end of dest, so dest keeps push order */
+	while( 0 < count )
+	{
+		chunk = (stack->top_size < count) ? stack->top_size : count;
+		count -= chunk;
+		stack->top_size -= chunk;
+		stack->size -= chunk;
+
+		if( NULL != dest_p )
+		{
+			memcpy(dest_p + count * stack->element_size,
+						stack->top->buffer + stack->top_size * stack->element_size,
+						chunk * stack->element_size);
+		}
+
+		if( 0 == stack->top_size && NULL != stack->top->prev )
+		{
+			PopSegment(stack);
+		}
+	}
+}
 
 
 int StackIsEmpty(const stack_t *stack)
@@ -87,21 +199,73 @@ size_t StackGetSize(const stack_t *stack)
 
 size_t StackGetCapacity(const stack_t *stack)
 {
-	return stack->capacity;
+	return stack->num_of_segments * stack->segment_capacity;
 }
 
 
 void *StackPeek(const stack_t *stack)
 {
 	size_t top_index = 0;
-	
-	if (StackIsEmpty(stack)) 
+
+	if (StackIsEmpty(stack))
 	{
 		fprintf(stderr, "Stack is empty, cannot peek\n");
 		return NULL;
 	}
-    
-	top_index = (stack->size - 1) * stack->element_size;
-	return &(stack->buffer[top_index]);
+
+	top_index = (stack->top_size - 1) * stack->element_size;
+	return &(stack->top->buffer[top_index]);
 }
 
+
+static struct stack_segment *CreateSegment(stack_t *stack)
+{
+	struct stack_segment *segment = (struct stack_segment *)malloc(
+							sizeof(struct stack_segment) +
+							stack->segment_capacity * stack->element_size);
+	if( NULL == segment )
+	{
+		return NULL;
+	}
+
+	segment->buffer = (char *)segment + sizeof(struct stack_segment);
+	return segment;
+}
+
+
+static int PushSegment(stack_t *stack)
+{
+	struct stack_segment *segment = stack->spare;
+
+	if( NULL == segment )
+	{
+		segment = CreateSegment(stack);
+		if( NULL == segment )
+		{
+			return 1;
+		}
+	}
+
+	stack->spare = NULL;
+	segment->prev = stack->top;
+	stack->top = segment;
+	stack->top_size = 0;
+	++stack->num_of_segments;
+
+	return 0;
+}
+
+
+/* keeps one emptied segment aside so pushing and popping across a segment
+   boundary does not call malloc and free every time */
+static void PopSegment(stack_t *stack)
+{
+	struct stack_segment *segment = stack->top;
+
+	stack->top = segment->prev;
+	stack->top_size = stack->segment_capacity;
+	--stack->num_of_segments;
+
+	free(stack->spare);
+	stack->spare = segment;
+}
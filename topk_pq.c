@@ -0,0 +1,222 @@
+/*
+   Code by: Or Yamin
+   Project: bounded top-K priority queue
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* Keeps only the best K elements of a stream, where "best" means the same as
+   in heap_pq: cmp(a, b) > 0 puts a before b. The K survivors live in a fixed
+   array heap whose root is the worst of them, so the root is the admission
+   threshold: most of a long stream is rejected after a single comparison,
+   and memory never grows after TopK_PQCreate. */
+
+#include <stdlib.h> /* size_t malloc() free() */
+#include <stddef.h> /* offsetof() */
+#include <assert.h> /* assert() */
+
+#include "topk_pq.h"
+
+struct topk_pq
+{
+	topk_pq_compare_func_t cmp_func;
+	size_t size;
+	size_t capacity;
+	void *elements[1];
+};
+
+
+static void SiftUp(topk_pq_t *queue, size_t index);
+static void SiftDown(topk_pq_t *queue, size_t index);
+static int IsWorse(const topk_pq_t *queue, void *data1, void *data2);
+
+
+topk_pq_t *TopK_PQCreate(size_t k, topk_pq_compare_func_t cmp_func)
+{
+	topk_pq_t *queue = NULL;
+
+	assert(cmp_func != NULL);
+	assert(0 < k);
+
+	queue = (topk_pq_t *)malloc(offsetof(topk_pq_t, elements) +
+													k * sizeof(void *));
+	if (queue == NULL)
+	{
+		return NULL;
+	}
+
+	queue->cmp_func = cmp_func;
+	queue->size = 0;
+	queue->capacity = k;
+
+	return queue;
+}
+
+
+
+void TopK_PQDestroy(topk_pq_t *queue)
+{
+	assert(queue != NULL);
+	free(queue);
+}
+
+
+
+/* returns NULL when data was kept and nothing dropped out; otherwise returns
+   whatever is no longer in the queue - data itself if it did not make the
+   cut, or the old worst element it replaced - so the caller can free it */
+void *TopK_PQOffer(topk_pq_t *queue, void *data)
+{
+	void *evicted = NULL;
+
+	assert(queue != NULL);
+	assert(data != NULL);
+
+	if (queue->size < queue->capacity)
+	{
+		queue->elements[queue->size] = data;
+		++queue->size;
+		SiftUp(queue, queue->size - 1);
+
+		return NULL;
+	}
+
+	/* the common case on a long stream: one comparison and out */
+	if (queue->cmp_func(data, queue->elements[0]) <= 0)
+	{
+		return data;
+	}
+
+	evicted = queue->elements[0];
+	queue->elements[0] = data;
+	SiftDown(queue, 0);
+
+	return evicted;
+}
+
+
+
+/* the worst element kept; anything not better than it is rejected */
+void *TopK_PQPeekWorst(const topk_pq_t *queue)
+{
+	assert(queue != NULL);
+	assert(0 < queue->size);
+
+	return queue->elements[0];
+}
+
+
+
+/* writes the kept elements to dest best first and empties the queue;
+   dest must have room for TopK_PQSize elements. Returns how many were written */
+size_t TopK_PQDrain(topk_pq_t *queue, void **dest)
+{
+	size_t count = 0;
+	size_t i = 0;
+
+	assert(queue != NULL);
+	assert(dest != NULL || queue->size == 0);
+
+	count = queue->size;
+
+	/* the root is the worst one left, so fill dest from the back */
+	for (i = count; 0 < i; --i)
+	{
+		dest[i - 1] = queue->elements[0];
+		--queue->size;
+		queue->elements[0] = queue->elements[queue->size];
+		SiftDown(queue, 0);
+	}
+
+	return count;
+}
+
+
+
+size_t TopK_PQSize(const topk_pq_t *queue)
+{
+	assert(queue != NULL);
+	return queue->size;
+}
+
+
+
+size_t TopK_PQCapacity(const topk_pq_t *queue)
+{
+	assert(queue != NULL);
+	return queue->capacity;
+}
+
+
+
+int TopK_PQIsEmpty(const topk_pq_t *queue)
+{
+	assert(queue != NULL);
+	return (queue->size == 0);
+}
+
+
+
+void TopK_PQClear(topk_pq_t *queue)
+{
+	assert(queue != NULL);
+	queue->size = 0;
+}
+
+
+/**************************************** Helpers *****************************/
+/* both sifts carry the moving element in a local and shift the others into
+   the hole it leaves, as heap.c does */
+static void SiftUp(topk_pq_t *queue, size_t index)
+{
+	void *data = queue->elements[index];
+	size_t parent = 0;
+
+	while (index > 0)
+	{
+		parent = (index - 1) / 2;
+		if (!IsWorse(queue, data, queue->elements[parent]))
+		{
+			break;
+		}
+
+		queue->elements[index] = queue->elements[parent];
+		index = parent;
+	}
+
+	queue->elements[index] = data;
+}
+
+static void SiftDown(topk_pq_t *queue, size_t index)
+{
+	void *data = queue->elements[index];
+	size_t child = 0;
+
+	while ((child = 2 * index + 1) < queue->size)
+	{
+		if (child + 1 < queue->size && IsWorse(queue,
+							queue->elements[child + 1], queue->elements[child]))
+		{
+			++child;
+		}
+
+		if (!IsWorse(queue, queue->elements[child], data))
+		{
+			break;
+		}
+
+		queue->elements[index] = queue->elements[child];
+		index = child;
+	}
+
+	queue->elements[index] = data;
+}
+
+/* the heap is ordered worst-on-top, the reverse of heap_pq */
+static int IsWorse(const topk_pq_t *queue, void *data1, void *data2)
+{
+	return (queue->cmp_func(data1, data2) < 0);
+}
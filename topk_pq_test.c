@@ -0,0 +1,172 @@
+/*
+   Code by: Or Yamin
+   Project: bounded top-K priority queue - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stdlib.h> /* rand() srand() qsort() */
+
+#include "topk_pq.h"
+
+#define K 10
+#define STREAM 10000
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+static int failures = 0;
+static int stream[STREAM];
+
+static void TestFewerThanK(void);
+static void TestStream(void);
+static void TestEvictions(void);
+static int CompareBigger(const void *data1, const void *data2);
+static int SortDescending(const void *data1, const void *data2);
+
+
+int main(void)
+{
+	size_t i = 0;
+
+	srand(3);
+	for (i = 0; i < STREAM; ++i)
+	{
+		stream[i] = rand() % (STREAM / 2);
+	}
+
+	TestFewerThanK();
+	TestStream();
+	TestEvictions();
+
+	if (0 == failures)
+	{
+		puts("topk_pq: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestFewerThanK(void)
+{
+	topk_pq_t *queue = TopK_PQCreate(K, CompareBigger);
+	void *out[K];
+	int values[] = {4, 9, 1};
+	size_t i = 0;
+
+	CHECK(NULL != queue);
+	CHECK(K == TopK_PQCapacity(queue));
+	CHECK(TopK_PQIsEmpty(queue));
+
+	for (i = 0; i < 3; ++i)
+	{
+		CHECK(NULL == TopK_PQOffer(queue, &values[i]));
+	}
+	CHECK(3 == TopK_PQSize(queue));
+	CHECK(&values[2] == TopK_PQPeekWorst(queue));
+
+	/* best first */
+	CHECK(3 == TopK_PQDrain(queue, out));
+	CHECK(&values[1] == out[0]);
+	CHECK(&values[0] == out[1]);
+	CHECK(&values[2] == out[2]);
+	CHECK(TopK_PQIsEmpty(queue));
+
+	TopK_PQDestroy(queue);
+}
+
+/* the survivors of a long stream are exactly its K biggest values */
+static void TestStream(void)
+{
+	topk_pq_t *queue = TopK_PQCreate(K, CompareBigger);
+	int sorted[STREAM];
+	void *out[K];
+	size_t i = 0;
+
+	for (i = 0; i < STREAM; ++i)
+	{
+		TopK_PQOffer(queue, &stream[i]);
+		sorted[i] = stream[i];
+		CHECK(TopK_PQSize(queue) <= K);
+	}
+	qsort(sorted, STREAM, sizeof(int), SortDescending);
+
+	CHECK(sorted[K - 1] == *(int *)TopK_PQPeekWorst(queue));
+	CHECK(K == TopK_PQDrain(queue, out));
+	for (i = 0; i < K; ++i)
+	{
+		CHECK(sorted[i] == *(int *)out[i]);
+	}
+
+	/* Clear empties the queue and it can be filled again */
+	TopK_PQOffer(queue, &stream[0]);
+	TopK_PQClear(queue);
+	CHECK(TopK_PQIsEmpty(queue));
+	CHECK(NULL == TopK_PQOffer(queue, &stream[0]));
+
+	TopK_PQDestroy(queue);
+}
+
+/* Offer hands back whatever left the queue, so every element offered is
+   either kept or returned exactly once */
+static void TestEvictions(void)
+{
+	topk_pq_t *queue = TopK_PQCreate(K, CompareBigger);
+	int returned[STREAM] = {0};
+	void *out[K];
+	int *evicted = NULL;
+	int tie = 0;
+	size_t i = 0;
+
+	for (i = 0; i < STREAM; ++i)
+	{
+		evicted = (int *)TopK_PQOffer(queue, &stream[i]);
+		if (NULL != evicted)
+		{
+			++returned[evicted - stream];
+		}
+	}
+	TopK_PQDrain(queue, out);
+	for (i = 0; i < K; ++i)
+	{
+		++returned[(int *)out[i] - stream];
+	}
+
+	for (i = 0; i < STREAM; ++i)
+	{
+		CHECK(1 == returned[i]);
+	}
+
+	/* an element equal to the worst one does not get in */
+	for (i = 0; i < K; ++i)
+	{
+		TopK_PQOffer(queue, &stream[i]);
+	}
+	tie = *(int *)TopK_PQPeekWorst(queue);
+	CHECK(&tie == TopK_PQOffer(queue, &tie));
+
+	TopK_PQDestroy(queue);
+}
+
+static int CompareBigger(const void *data1, const void *data2)
+{
+	return *(const int *)data1 - *(const int *)data2;
+}
+
+static int SortDescending(const void *data1, const void *data2)
+{
+	return *(const int *)data2 - *(const int *)data1;
+}
@@ -0,0 +1,438 @@
+/*
+   Code by: Or Yamin
+   Project: Unrolled linked list data structure
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* Same iterator semantics as dllist, but every node holds up to
+   UNROLL_FACTOR data pointers, so a scan takes one cache miss per node
+   instead of one per element. An iterator is a {node, index} pair; inserting
+   or removing may move other elements of the same node, so only the
+   iterator returned by the call stays valid. */
+
+#include <stdlib.h> /* size_t malloc() free() */
+#include <string.h> /* memmove() memcpy() */
+#include <assert.h> /* assert() */
+
+#include "ullist.h"
+
+/* 13 pointers + count + two links fill two 64 byte cache lines */
+#define UNROLL_FACTOR 13
+#define SPLIT_POINT (UNROLL_FACTOR / 2)
+#define MERGE_THRESHOLD (UNROLL_FACTOR / 4)
+
+struct ullist_node
+{
+    struct ullist_node *next;
+    struct ullist_node *prev;
+    size_t count;
+    void *data[UNROLL_FACTOR];
+};
+
+struct ullist
+{
+    struct ullist_node sentinel;
+    size_t size;
+};
+
+
+static struct ullist_node *CreateNode(struct ullist_node *where);
+static void DestroyNode(struct ullist_node *node);
+static ullist_iter_t MakeIter(struct ullist_node *node, size_t index);
+static void InsertAt(struct ullist_node *node, size_t index, void *data);
+static ullist_iter_t Split(struct ullist_node *node, size_t index);
+
+
+ullist_t *UllistCreate(void)
+{
+	ullist_t *list = (ullist_t *)malloc(sizeof(ullist_t));
+	if (NULL == list)
+	{
+		return NULL;
+	}
+
+	list->sentinel.next = &list->sentinel;
+	list->sentinel.prev = &list->sentinel;
+	list->sentinel.count = 0;
+	list->size = 0;
+
+	return list;
+}
+
+
+
+void UllistDestroy(ullist_t *list)
+{
+	struct ullist_node *current = NULL;
+	struct ullist_node *next = NULL;
+
+	assert(NULL != list);
+
+	for (current = list->sentinel.next; current != &list->sentinel; current = next)
+	{
+		next = current->next;
+		free(current);
+	}
+
+	free(list);
+}
+
+
+
+ullist_iter_t UllistNext(ullist_iter_t iter)
+{
+	assert(NULL != iter.node);
+	assert(iter.index < iter.node->count);
+
+	if (iter.index + 1 < iter.node->count)
+	{
+		return MakeIter(iter.node, iter.index + 1);
+	}
+
+	return MakeIter(iter.node->next, 0);
+}
+
+
+
+ullist_iter_t UllistPrev(ullist_iter_t iter)
+{
+	assert(NULL != iter.node);
+
+	if (0 < iter.index)
+	{
+		return MakeIter(iter.node, iter.index - 1);
+	}
+
+	assert(0 < iter.node->prev->count);
+	return MakeIter(iter.node->prev, iter.node->prev->count - 1);
+}
+
+
+
+ullist_iter_t UllistGetBegin(const ullist_t *list)
+{
+	assert(NULL != list);
+	return MakeIter(list->sentinel.next, 0);
+}
+
+
+
+ullist_iter_t UllistGetEnd(const ullist_t *list)
+{
+	assert(NULL != list);
+	return MakeIter((struct ullist_node *)&list->sentinel, 0);
+}
+
+
+
+ullist_iter_t UllistInsertBefore(ullist_t *list, void *data, ullist_iter_t where)
+{
+	struct ullist_node *node = where.node;
+	struct ullist_node *prev = NULL;
+
+	assert(NULL != list);
+	assert(NULL != node);
+
+	/* inserting at the front of a node: fill the previous node first */
+	prev = node->prev;
+	if (0 == where.index && prev != &list->sentinel && prev->count < UNROLL_FACTOR)
+	{
+		InsertAt(prev, prev->count, data);
+		++list->size;
+		return MakeIter(prev, prev->count - 1);
+	}
+
+	if (node == &list->sentinel)
+	{
+		node = CreateNode(node);
+		if (NULL == node)
+		{
+			return UllistGetEnd(list);
+		}
+		where = MakeIter(node, 0);
+	}
+	else if (UNROLL_FACTOR == node->count)
+	{
+		where = Split(node, where.index);
+		if (NULL == where.node)
+		{
+			return UllistGetEnd(list);
+		}
+	}
+
+	InsertAt(where.node, where.index, data);
+	++list->size;
+
+	return where;
+}
+
+
+
+ullist_iter_t UllistRemove(ullist_t *list, ullist_iter_t where)
+{
+	struct ullist_node *node = where.node;
+	struct ullist_node *next = NULL;
+
+	assert(NULL != list);
+	assert(NULL != node);
+	assert(where.index < node->count);
+
+	memmove(&node->data[where.index], &node->data[where.index + 1],
+							(node->count - where.index - 1) * sizeof(void *));
+	--node->count;
+	--list->size;
+
+	next = node->next;
+	if (0 == node->count)
+	{
+		DestroyNode(node);
+		return MakeIter(next, 0);
+	}
+
+	/* keep nodes reasonably full so scans stay dense */
+	if (node->count <= MERGE_THRESHOLD && next != &list->sentinel &&
+									node->count + next->count <= UNROLL_FACTOR)
+	{
+		memcpy(&node->data[node->count], next->data,
+											next->count * sizeof(void *));
+		node->count += next->count;
+		DestroyNode(next);
+	}
+
+	if (where.index < node->count)
+	{
+		return where;
+	}
+
+	return MakeIter(node->next, 0);
+}
+
+
+
+size_t UllistSize(const ullist_t *list)
+{
+	assert(NULL != list);
+	return list->size;
+}
+
+
+
+void *UllistGetData(ullist_iter_t iter)
+{
+	assert(NULL != iter.node);
+	assert(iter.index < iter.node->count);
+
+	return iter.node->data[iter.index];
+}
+
+
+
+ullist_iter_t UllistSetData(ullist_iter_t iter, void *new_data)
+{
+	assert(NULL != iter.node);
+	assert(iter.index < iter.node->count);
+
+	iter.node->data[iter.index] = new_data;
+	return iter;
+}
+
+
+
+ullist_iter_t UllistFind(void *param, ullist_iter_t from, ullist_iter_t to,
+												ullist_match_func_t is_match)
+{
+	size_t i = 0;
+	size_t end = 0;
+
+	assert(NULL != from.node && NULL != to.node);
+	assert(NULL != is_match);
+
+	for (;;)
+	{
+		end = (from.node == to.node) ? to.index : from.node->count;
+
+		for (i = from.index; i < end; ++i)
+		{
+			if (is_match(from.node->data[i], param))
+			{
+				return MakeIter(from.node, i);
+			}
+		}
+
+		if (from.node == to.node)
+		{
+			return to;
+		}
+
+		from = MakeIter(from.node->next, 0);
+	}
+}
+
+
+
+int UllistIsSameIter(ullist_iter_t iter1, ullist_iter_t iter2)
+{
+	return (iter1.node == iter2.node && iter1.index == iter2.index);
+}
+
+
+
+int UllistIsEmpty(const ullist_t *list)
+{
+	assert(NULL != list);
+	return (0 == list->size);
+}
+
+
+
+int UllistForEach(ullist_iter_t from, ullist_iter_t to,
+									ullist_action_func_t action, void *param)
+{
+	int status = 0;
+	size_t i = 0;
+	size_t end = 0;
+
+	assert(NULL != from.node && NULL != to.node);
+	assert(NULL != action);
+
+	for (;;)
+	{
+		end = (from.node == to.node) ? to.index : from.node->count;
+
+		for (i = from.index; i < end; ++i)
+		{
+			status = action(from.node->data[i], param);
+		}
+
+		if (from.node == to.node)
+		{
+			return status;
+		}
+
+		from = MakeIter(from.node->next, 0);
+	}
+}
+
+
+
+ullist_iter_t UllistPushFront(ullist_t *list, void *data)
+{
+	assert(NULL != list);
+	return UllistInsertBefore(list, data, UllistGetBegin(list));
+}
+
+
+
+ullist_iter_t UllistPushBack(ullist_t *list, void *data)
+{
+	assert(NULL != list);
+	return UllistInsertBefore(list, data, UllistGetEnd(list));
+}
+
+
+
+void *UllistPopFront(ullist_t *list)
+{
+	ullist_iter_t begin;
+	void *data = NULL;
+
+	assert(NULL != list);
+	assert(0 < list->size);
+
+	begin = UllistGetBegin(list);
+	data = UllistGetData(begin);
+	UllistRemove(list, begin);
+
+	return data;
+}
+
+
+
+void *UllistPopBack(ullist_t *list)
+{
+	ullist_iter_t last;
+	void *data = NULL;
+
+	assert(NULL != list);
+	assert(0 < list->size);
+
+	last = UllistPrev(UllistGetEnd(list));
+	data = UllistGetData(last);
+	UllistRemove(list, last);
+
+	return data;
+}
+
+
+/**************************************** Helpers *****************************/
+/* allocates an empty node and links it right before where */
+static struct ullist_node *CreateNode(struct ullist_node *where)
+{
+	struct ullist_node *node = (struct ullist_node *)malloc(
+												sizeof(struct ullist_node));
+	if (NULL == node)
+	{
+		return NULL;
+	}
+
+	node->count = 0;
+	node->next = where;
+	node->prev = where->prev;
+	where->prev->next = node;
+	where->prev = node;
+
+	return node;
+}
+
+static void DestroyNode(struct ullist_node *node)
+{
+	node->prev->next = node->next;
+	node->next->prev = node->prev;
+	free(node);
+}
+
+static ullist_iter_t MakeIter(struct ullist_node *node, size_t index)
+{
+	ullist_iter_t iter;
+
+	iter.node = node;
+	iter.index = index;
+
+	return iter;
+}
+
+static void InsertAt(struct ullist_node *node, size_t index, void *data)
+{
+	memmove(&node->data[index + 1], &node->data[index],
+										(node->count - index) * sizeof(void *));
+	node->data[index] = data;
+	++node->count;
+}
+
+/* moves the upper half of a full node into a new node after it and returns
+   where the element that was at index now has to go */
+static ullist_iter_t Split(struct ullist_node *node, size_t index)
+{
+	struct ullist_node *new_node = CreateNode(node->next);
+
+	if (NULL == new_node)
+	{
+		return MakeIter(NULL, 0);
+	}
+
+	memcpy(new_node->data, &node->data[SPLIT_POINT],
+							(UNROLL_FACTOR - SPLIT_POINT) * sizeof(void *));
+	new_node->count = UNROLL_FACTOR - SPLIT_POINT;
+	node->count = SPLIT_POINT;
+
+	if (index <= SPLIT_POINT)
+	{
+		return MakeIter(node, index);
+	}
+
+	return MakeIter(new_node, index - SPLIT_POINT);
+}
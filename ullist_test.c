@@ -0,0 +1,234 @@
+/*
+   Code by: Or Yamin
+   Project: Unrolled linked list - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stdlib.h> /* rand() srand() */
+#include <string.h> /* memmove() */
+
+#include "ullist.h"
+
+#define VALUES 500
+#define OPERATIONS 5000
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+static int failures = 0;
+static int values[VALUES];
+
+static void TestEnds(void);
+static void TestAgainstArray(void);
+static void TestFindForEach(void);
+static ullist_iter_t IterAt(const ullist_t *list, size_t index);
+static int Matches(const ullist_t *list, void **expected, size_t count);
+static int IsValue(const void *data, const void *param);
+static int Sum(void *data, void *param);
+
+
+int main(void)
+{
+	size_t i = 0;
+
+	for (i = 0; i < VALUES; ++i)
+	{
+		values[i] = (int)i;
+	}
+
+	TestEnds();
+	TestAgainstArray();
+	TestFindForEach();
+
+	if (0 == failures)
+	{
+		puts("ullist: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestEnds(void)
+{
+	ullist_t *list = UllistCreate();
+	size_t i = 0;
+
+	CHECK(NULL != list);
+	CHECK(UllistIsEmpty(list));
+	CHECK(UllistIsSameIter(UllistGetBegin(list), UllistGetEnd(list)));
+
+	/* enough elements for several nodes on each side */
+	for (i = 0; i < 50; ++i)
+	{
+		UllistPushBack(list, &values[50 + i]);
+		UllistPushFront(list, &values[49 - i]);
+	}
+	CHECK(100 == UllistSize(list));
+
+	for (i = 0; i < 50; ++i)
+	{
+		CHECK(&values[i] == UllistPopFront(list));
+		CHECK(&values[99 - i] == UllistPopBack(list));
+	}
+	CHECK(UllistIsEmpty(list));
+
+	UllistDestroy(list);
+}
+
+/* random inserts and removes split and merge nodes; the list must always
+   read the same as a plain array given the same operations */
+static void TestAgainstArray(void)
+{
+	ullist_t *list = UllistCreate();
+	void *expected[OPERATIONS];
+	ullist_iter_t iter;
+	size_t count = 0;
+	size_t index = 0;
+	size_t i = 0;
+
+	srand(7);
+
+	for (i = 0; i < OPERATIONS; ++i)
+	{
+		index = (0 == count) ? 0 : (size_t)rand() % (count + 1);
+
+		if (0 == count || 0 != rand() % 3)
+		{
+			iter = UllistInsertBefore(list, &values[i % VALUES],
+													IterAt(list, index));
+			CHECK(&values[i % VALUES] == UllistGetData(iter));
+
+			memmove(&expected[index + 1], &expected[index],
+										(count - index) * sizeof(void *));
+			expected[index] = &values[i % VALUES];
+			++count;
+		}
+		else
+		{
+			index %= count;
+			iter = UllistRemove(list, IterAt(list, index));
+
+			memmove(&expected[index], &expected[index + 1],
+									(count - index - 1) * sizeof(void *));
+			--count;
+
+			/* the iterator returned points at the element after the one
+			   removed */
+			CHECK((index == count) ?
+						UllistIsSameIter(UllistGetEnd(list), iter) :
+						expected[index] == UllistGetData(iter));
+		}
+
+		if (0 == i % 500)
+		{
+			CHECK(Matches(list, expected, count));
+		}
+	}
+
+	CHECK(Matches(list, expected, count));
+
+	/* SetData replaces in place */
+	iter = UllistSetData(UllistGetBegin(list), &values[0]);
+	CHECK(&values[0] == UllistGetData(UllistGetBegin(list)));
+	CHECK(&values[0] == UllistGetData(iter));
+
+	UllistDestroy(list);
+}
+
+static void TestFindForEach(void)
+{
+	ullist_t *list = UllistCreate();
+	ullist_iter_t found;
+	int target = 37;
+	int sum = 0;
+	size_t i = 0;
+
+	for (i = 0; i < 100; ++i)
+	{
+		UllistPushBack(list, &values[i]);
+	}
+
+	found = UllistFind(&target, UllistGetBegin(list), UllistGetEnd(list),
+																IsValue);
+	CHECK(&values[37] == UllistGetData(found));
+
+	target = -1;
+	found = UllistFind(&target, UllistGetBegin(list), UllistGetEnd(list),
+																IsValue);
+	CHECK(UllistIsSameIter(UllistGetEnd(list), found));
+
+	CHECK(0 == UllistForEach(UllistGetBegin(list), UllistGetEnd(list), Sum,
+																	&sum));
+	CHECK(99 * 100 / 2 == sum);
+
+	UllistDestroy(list);
+}
+
+static ullist_iter_t IterAt(const ullist_t *list, size_t index)
+{
+	ullist_iter_t iter = UllistGetBegin(list);
+
+	while (0 < index--)
+	{
+		iter = UllistNext(iter);
+	}
+
+	return iter;
+}
+
+/* walks forwards and then backwards */
+static int Matches(const ullist_t *list, void **expected, size_t count)
+{
+	ullist_iter_t iter;
+	size_t i = 0;
+
+	if (count != UllistSize(list))
+	{
+		return 0;
+	}
+
+	for (iter = UllistGetBegin(list);
+			!UllistIsSameIter(iter, UllistGetEnd(list)); iter = UllistNext(iter))
+	{
+		if (i == count || expected[i++] != UllistGetData(iter))
+		{
+			return 0;
+		}
+	}
+
+	for (iter = UllistGetEnd(list); 0 < i; --i)
+	{
+		iter = UllistPrev(iter);
+		if (expected[i - 1] != UllistGetData(iter))
+		{
+			return 0;
+		}
+	}
+
+	return UllistIsSameIter(iter, UllistGetBegin(list));
+}
+
+static int IsValue(const void *data, const void *param)
+{
+	return (*(const int *)data == *(const int *)param);
+}
+
+static int Sum(void *data, void *param)
+{
+	*(int *)param += *(int *)data;
+	return 0;
+}
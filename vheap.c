@@ -0,0 +1,260 @@
+/*
+   Code by: Or Yamin
+   Project: value heap (elements stored inline)
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+/* Like heap.c, but the heap owns copies of fixed-size elements kept side by
+   side in a dvector, the way dvector stores them, instead of pointers to
+   objects allocated elsewhere. A comparison reads two slots of the same
+   buffer, and small records need no allocation of their own.
+
+   The compare function gets pointers to two elements and follows heap.c:
+   cmp(a, b) > 0 puts a on top. A keyed heap has no compare function at all;
+   it orders by a size_t stored at key_offset inside every element, smallest
+   key on top. */
+
+#include <assert.h> /* assert */
+#include <stdlib.h> /* size_t malloc free */
+#include <string.h> /* memcpy */
+
+#include "dvector.h"
+#include "vheap.h"
+
+#define INIT_VECTOR_SIZE 8
+
+struct vheap
+{
+	dvector_t *vector;
+	vheap_compare_func_t cmp_func;
+	size_t element_size;
+	size_t key_offset;
+	char *scratch;
+};
+
+static vheap_t *CreateVHeap(size_t element_size,
+						vheap_compare_func_t compare_func, size_t key_offset);
+static void SiftUp(vheap_t *heap, size_t index);
+static void SiftDown(vheap_t *heap, size_t index);
+static int IsBefore(const vheap_t *heap, const char *element1,
+													const char *element2);
+static size_t GetKey(const vheap_t *heap, const char *element);
+static char *GetElement(vheap_t *heap, size_t index);
+
+
+vheap_t *VHeapCreate(size_t element_size, vheap_compare_func_t compare_func)
+{
+	assert(0 < element_size);
+	assert(NULL != compare_func);
+
+	return CreateVHeap(element_size, compare_func, 0);
+}
+
+/* orders by the size_t at key_offset in each element, smallest first, with
+   no function call per comparison */
+vheap_t *VHeapCreateKeyed(size_t element_size, size_t key_offset)
+{
+	assert(key_offset + sizeof(size_t) <= element_size);
+
+	return CreateVHeap(element_size, NULL, key_offset);
+}
+
+void VHeapDestroy(vheap_t *heap)
+{
+	assert(NULL != heap);
+
+	DvectorDestroy(heap->vector);
+	free(heap->scratch);
+	free(heap);
+}
+
+/* copies element into the heap */
+int VHeapPush(vheap_t *heap, const void *element)
+{
+	assert(NULL != heap);
+	assert(NULL != element);
+
+	if (0 != DvectorPushBack(heap->vector, element))
+	{
+		return 1;
+	}
+
+	SiftUp(heap, VHeapSize(heap) - 1);
+
+	return 0;
+}
+
+/* copies the top element to dest, unless dest is NULL, and removes it */
+void VHeapPop(vheap_t *heap, void *dest)
+{
+	size_t last_index = 0;
+
+	assert(NULL != heap);
+	assert(!VHeapIsEmpty(heap));
+
+	if (NULL != dest)
+	{
+		memcpy(dest, GetElement(heap, 0), heap->element_size);
+	}
+
+	last_index = VHeapSize(heap) - 1;
+	if (0 < last_index)
+	{
+		memcpy(GetElement(heap, 0), GetElement(heap, last_index),
+														heap->element_size);
+	}
+	DvectorPopBack(heap->vector);
+
+	if (0 < last_index)
+	{
+		SiftDown(heap, 0);
+	}
+}
+
+/* points into the heap's buffer; valid until the next push or pop */
+const void *VHeapPeek(const vheap_t *heap)
+{
+	assert(NULL != heap);
+	assert(!VHeapIsEmpty(heap));
+
+	return DvectorGetElement(heap->vector, 0);
+}
+
+size_t VHeapSize(const vheap_t *heap)
+{
+	assert(NULL != heap);
+	return DvectorSize(heap->vector);
+}
+
+int VHeapIsEmpty(const vheap_t *heap)
+{
+	assert(NULL != heap);
+	return (0 == VHeapSize(heap));
+}
+
+void VHeapClear(vheap_t *heap)
+{
+	assert(NULL != heap);
+
+	DvectorResize(heap->vector, 0);
+}
+
+
+/**************************************** Helpers *****************************/
+static vheap_t *CreateVHeap(size_t element_size,
+						vheap_compare_func_t compare_func, size_t key_offset)
+{
+	vheap_t *heap = (vheap_t *)malloc(sizeof(vheap_t));
+	if (NULL == heap)
+	{
+		return NULL;
+	}
+
+	/* holds the element being sifted while the others shift into its hole */
+	heap->scratch = (char *)malloc(element_size);
+	if (NULL == heap->scratch)
+	{
+		free(heap);
+		return NULL;
+	}
+
+	heap->vector = DvectorCreate(INIT_VECTOR_SIZE, element_size);
+	if (NULL == heap->vector)
+	{
+		free(heap->scratch);
+		free(heap);
+		return NULL;
+	}
+
+	heap->cmp_func = compare_func;
+	heap->element_size = element_size;
+	heap->key_offset = key_offset;
+
+	return heap;
+}
+
+/* both sifts look the buffer up once and index it directly */
+static void SiftUp(vheap_t *heap, size_t index)
+{
+	char *base = GetElement(heap, 0);
+	size_t element_size = heap->element_size;
+	size_t parent_index = 0;
+
+	memcpy(heap->scratch, base + index * element_size, element_size);
+
+	while (index > 0)
+	{
+		parent_index = (index - 1) / 2;
+		if (!IsBefore(heap, heap->scratch, base + parent_index * element_size))
+		{
+			break;
+		}
+
+		memcpy(base + index * element_size, base + parent_index * element_size,
+																element_size);
+		index = parent_index;
+	}
+
+	memcpy(base + index * element_size, heap->scratch, element_size);
+}
+
+static void SiftDown(vheap_t *heap, size_t index)
+{
+	char *base = GetElement(heap, 0);
+	size_t element_size = heap->element_size;
+	size_t size = VHeapSize(heap);
+	size_t child_index = 0;
+
+	memcpy(heap->scratch, base + index * element_size, element_size);
+
+	while ((child_index = 2 * index + 1) < size)
+	{
+		if (child_index + 1 < size && IsBefore(heap,
+								base + (child_index + 1) * element_size,
+								base + child_index * element_size))
+		{
+			++child_index;
+		}
+
+		if (!IsBefore(heap, base + child_index * element_size, heap->scratch))
+		{
+			break;
+		}
+
+		memcpy(base + index * element_size, base + child_index * element_size,
+																element_size);
+		index = child_index;
+	}
+
+	memcpy(base + index * element_size, heap->scratch, element_size);
+}
+
+static int IsBefore(const vheap_t *heap, const char *element1,
+													const char *element2)
+{
+	if (NULL == heap->cmp_func)
+	{
+		return (GetKey(heap, element1) < GetKey(heap, element2));
+	}
+
+	return (0 < heap->cmp_func(element1, element2));
+}
+
+/* memcpy, because element_size need not keep the key aligned */
+static size_t GetKey(const vheap_t *heap, const char *element)
+{
+	size_t key = 0;
+
+	memcpy(&key, element + heap->key_offset, sizeof(size_t));
+
+	return key;
+}
+
+static char *GetElement(vheap_t *heap, size_t index)
+{
+	return (char *)DvectorGetElement(heap->vector, index);
+}
@@ -0,0 +1,193 @@
+/*
+   Code by: Or Yamin
+   Project: value heap (elements stored inline) - tests
+   Date: 19/10/2026
+   Review by:
+   Review Date:
+   Approved by:
+   Approval Date:
+*/
+
+#include <stdio.h> /* printf() puts() */
+#include <stdlib.h> /* rand() srand() */
+#include <stddef.h> /* offsetof() */
+
+#include "vheap.h"
+
+#define ITEMS 5000
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			++failures; \
+		} \
+	} \
+	while (0)
+
+/* id tells the copies apart; the key is deliberately not the first field */
+struct record
+{
+	int id;
+	size_t key;
+	char tag;
+};
+
+static int failures = 0;
+static struct record records[ITEMS];
+
+static void TestCompareFunc(void);
+static void TestKeyed(void);
+static void TestCopies(void);
+static int IsDrainedInOrder(vheap_t *heap, size_t count);
+static int CompareSmallerKey(const void *element1, const void *element2);
+
+
+int main(void)
+{
+	size_t i = 0;
+
+	srand(19);
+	for (i = 0; i < ITEMS; ++i)
+	{
+		records[i].id = (int)i;
+		records[i].key = (size_t)(rand() % 1000);
+		records[i].tag = (char)('a' + i % 26);
+	}
+
+	TestCompareFunc();
+	TestKeyed();
+	TestCopies();
+
+	if (0 == failures)
+	{
+		puts("vheap: all tests passed");
+	}
+
+	return failures;
+}
+
+
+static void TestCompareFunc(void)
+{
+	vheap_t *heap = VHeapCreate(sizeof(struct record), CompareSmallerKey);
+	size_t i = 0;
+
+	CHECK(NULL != heap);
+	CHECK(VHeapIsEmpty(heap));
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		CHECK(0 == VHeapPush(heap, &records[i]));
+	}
+	CHECK(ITEMS == VHeapSize(heap));
+	CHECK(IsDrainedInOrder(heap, ITEMS));
+
+	/* Clear keeps the heap usable */
+	for (i = 0; i < 100; ++i)
+	{
+		VHeapPush(heap, &records[i]);
+	}
+	VHeapClear(heap);
+	CHECK(VHeapIsEmpty(heap));
+	VHeapPush(heap, &records[0]);
+	CHECK(1 == VHeapSize(heap));
+
+	VHeapDestroy(heap);
+}
+
+/* the keyed heap orders by the size_t at the offset, smallest first */
+static void TestKeyed(void)
+{
+	vheap_t *heap = VHeapCreateKeyed(sizeof(struct record),
+											offsetof(struct record, key));
+	size_t i = 0;
+
+	CHECK(NULL != heap);
+
+	for (i = 0; i < ITEMS; ++i)
+	{
+		VHeapPush(heap, &records[i]);
+	}
+	CHECK(IsDrainedInOrder(heap, ITEMS));
+
+	/* pushes and pops interleaved */
+	for (i = 0; i < ITEMS; ++i)
+	{
+		VHeapPush(heap, &records[i]);
+		if (0 == i % 3)
+		{
+			VHeapPop(heap, NULL);
+		}
+	}
+	CHECK(ITEMS - (ITEMS + 2) / 3 == VHeapSize(heap));
+	CHECK(IsDrainedInOrder(heap, VHeapSize(heap)));
+
+	VHeapDestroy(heap);
+}
+
+/* the heap holds copies: the caller's element can change after a push, and
+   a popped element is whole */
+static void TestCopies(void)
+{
+	vheap_t *heap = VHeapCreateKeyed(sizeof(struct record),
+											offsetof(struct record, key));
+	struct record element = {7, 3, 'x'};
+	struct record popped = {0, 0, 0};
+
+	VHeapPush(heap, &element);
+	element.key = 1;
+	element.id = 8;
+	VHeapPush(heap, &element);
+	element.key = 0;
+
+	CHECK(8 == ((const struct record *)VHeapPeek(heap))->id);
+	CHECK(1 == ((const struct record *)VHeapPeek(heap))->key);
+
+	VHeapPop(heap, &popped);
+	CHECK(8 == popped.id && 1 == popped.key && 'x' == popped.tag);
+	VHeapPop(heap, &popped);
+	CHECK(7 == popped.id && 3 == popped.key && 'x' == popped.tag);
+	CHECK(VHeapIsEmpty(heap));
+
+	VHeapDestroy(heap);
+}
+
+/* pops count elements, each one the record it was pushed as and with a key
+   no smaller than the one before */
+static int IsDrainedInOrder(vheap_t *heap, size_t count)
+{
+	struct record popped = {0, 0, 0};
+	const struct record *top = NULL;
+	size_t last = 0;
+	size_t i = 0;
+
+	for (i = 0; i < count; ++i)
+	{
+		top = (const struct record *)VHeapPeek(heap);
+		if (top->key < last)
+		{
+			return 0;
+		}
+		last = top->key;
+
+		VHeapPop(heap, &popped);
+		if (last != popped.key || records[popped.id].key != popped.key ||
+										records[popped.id].tag != popped.tag)
+		{
+			return 0;
+		}
+	}
+
+	return VHeapIsEmpty(heap);
+}
+
+static int CompareSmallerKey(const void *element1, const void *element2)
+{
+	size_t key1 = ((const struct record *)element1)->key;
+	size_t key2 = ((const struct record *)element2)->key;
+
+	return (key1 < key2) - (key1 > key2);
+}